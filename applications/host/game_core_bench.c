@@ -0,0 +1,146 @@
+/**
+* Brief:
+* plays random games on the game core as fast as it can and reports how many shapes it locks per second.
+* Every shape gets a random number of rotations and a random column, then soft drops until it locks;
+* a new game starts whenever the last one is over
+*
+* With -c it instead times core routines against the code they replaced (core_bench.c), the same comparison the
+* CORE_BENCH build of main.c makes in mcycles on the board, here in nanoseconds
+*
+* usage: game_core_bench [pieces]
+*        game_core_bench -c [rounds]
+* exits with 1 if the core locks fewer than MIN_PIECES_PER_SECOND shapes per second, or if -c finds a routine
+* that gives a different result than the code it replaced
+**/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "core_bench.h"
+#include "game_core.h"
+
+#define DEFAULT_PIECES 5000000
+#define MIN_PIECES_PER_SECOND 1000000
+#define DEFAULT_ROUNDS 100000
+
+/**
+ * @brief bench_counter_t for a PC
+ *
+ * @return CLOCK_MONOTONIC in nanoseconds; wraps every 4 s, so only differences over shorter spans mean anything
+ */
+unsigned int read_nanoseconds() {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned int) (now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+/**
+ * @brief prints one core_bench comparison
+ *
+ * @param name
+ * @param result
+ * @return true if both sides gave the same results
+ */
+bool print_comparison(const char *name, const core_bench_result_t *result) {
+    printf("%s calls %u new %.1f ns/call old %.1f ns/call (%.1fx) %s\n", name, result->calls,
+           (double) result->new_ticks / result->calls, (double) result->old_ticks / result->calls,
+           (double) result->old_ticks / result->new_ticks, result->matched ? "ok" : "MISMATCH");
+
+    return result->matched;
+}
+
+/**
+ * @brief runs the core_bench comparisons
+ *
+ * @param rounds
+ * @return exit code
+ */
+int compare_replaced_code(unsigned int rounds) {
+    core_bench_result_t result;
+    bool matched = true;
+
+    bench_rotation(&result, read_nanoseconds, rounds);
+    matched &= print_comparison("rotation", &result);
+    bench_score_update(&result, read_nanoseconds, rounds);
+    matched &= print_comparison("score", &result);
+
+    return matched ? 0 : 1;
+}
+
+/**
+ * @brief linear congruential generator for the bench's own moves; kept apart from the game's randomizer
+ *
+ * @param state
+ * @return 31 random bits
+ */
+unsigned int bench_random(unsigned long long *state) {
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (unsigned int) (*state >> 33);
+}
+
+int main(int argc, char **argv) {
+    if ((argc > 1) && (strcmp(argv[1], "-c") == 0)) {
+        return compare_replaced_code((argc > 2) ? strtoul(argv[2], NULL, 10) : DEFAULT_ROUNDS);
+    }
+
+    unsigned long pieces = (argc > 1) ? strtoul(argv[1], NULL, 10) : DEFAULT_PIECES;
+    unsigned long locked = 0;
+    unsigned long games = 1;
+    unsigned long steps = 0;
+    unsigned long lines = 0;
+    unsigned long long bench_state = 1;
+    unsigned int events = 0;
+    struct timespec start, stop;
+    game_state_t game;
+
+    game_init(&game, 1);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    while (locked < pieces) {
+        unsigned int rotations = bench_random(&bench_state) % NUM_OF_ORIENTATIONS;
+        int shift = (int) (bench_random(&bench_state) % GAME_BOARD_X_MAX) - SPAWN_ORIGIN_COL - 1;
+
+        for (unsigned int i = 0; i < rotations; i++) {
+            game_step(&game, GAME_INPUT_ROTATE);
+            steps++;
+        }
+        for (; shift < 0; shift++) {
+            game_step(&game, GAME_INPUT_LEFT);
+            steps++;
+        }
+        for (; shift > 0; shift--) {
+            game_step(&game, GAME_INPUT_RIGHT);
+            steps++;
+        }
+
+        do {
+            events = game_step(&game, GAME_INPUT_SOFT_DROP);
+            steps++;
+        } while (!(events & GAME_EVENT_LOCKED));
+
+        locked++;
+        if (events & GAME_EVENT_LINES) {
+            lines += game.line_count;
+        }
+
+        if (game.game_over) {
+            game_init(&game, games + 1);
+            games++;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    double seconds = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) / 1e9;
+    double pieces_per_second = locked / seconds;
+
+    printf("pieces %lu games %lu steps %lu lines %lu\n", locked, games, steps, lines);
+    printf("time %.3f s, %.0f pieces/s, %.1f ns/step\n", seconds, pieces_per_second, seconds * 1e9 / steps);
+
+    if (pieces_per_second < MIN_PIECES_PER_SECOND) {
+        printf("FAIL: below %d pieces/s\n", MIN_PIECES_PER_SECOND);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,610 @@
+/**
+* Brief:
+* plays scripted games on game_core.c and, step by step, on a copy of the rules main.c had before they moved into
+* the core (reference_*: bitboard, table rotation with wall kicks, gravity table, soft drop scoring), and checks
+* that both leave the same board, falling shape, score, lines, level and drop speed after every step.
+* The shapes come from the core: the reference takes each shape the core deals, the old code drew them with rand().
+* Hard drops came after the core and are not scripted.
+*
+* The reference is main.c just before the move, after the table rotation had added wall kicks. It shows the core
+* kept those rules; it says nothing about the game before the wall kicks, which dropped every rotation that collided.
+*
+* Each game is scripted by a small player that tries every rotation and column of a shape on a copy of the game,
+* keeps the placement that leaves the fewest holes and the lowest stack, and sometimes picks one at random so the
+* games end. The shape then moves there one column per frame while it falls, by gravity, soft drops or both.
+* The last game only soft drops every shape where it spawns, which ends it in a few shapes.
+*
+* usage: game_core_test
+* prints one line per game; exits with 1 if a game diverged, or if the games no longer clear enough lines
+* to change level or no longer reach game over
+**/
+#include <stdbool.h>
+#include <stdio.h>
+#include "game_core.h"
+
+#define SCRIPTED_GAMES 8
+#define MAX_PIECES 400      // a game that is still going after this many shapes is stopped
+#define RANDOM_PLACEMENT 8  // 1 in this many shapes goes to a random rotation and column
+#define MIN_TOTAL_LINES 10  // enough for a level change
+
+/** weights of the placement the player picks **/
+#define LINE_WEIGHT   760
+#define HEIGHT_WEIGHT 510
+#define HOLE_WEIGHT   3560
+#define BUMP_WEIGHT   180
+#define GAME_OVER_VALUE (-1000000)
+
+// tables game_core.c shares with the rules it replaced
+extern const signed char wall_kicks[NUM_OF_TETRIS_SHAPES][MAX_WALL_KICKS];
+extern const unsigned char wall_kick_count[NUM_OF_TETRIS_SHAPES];
+extern const unsigned char gravity_frames[MAX_GRAVITY_LEVEL + 1];
+
+// not in game_core.h, the game sets the speed itself
+void update_game_speed(game_state_t *game);
+
+// the game state main.c kept in globals and in the locals of its game loop
+typedef struct reference_game {
+    unsigned short int board_rows[GAME_BOARD_Y_MAX + 1];
+    unsigned int board_colors[GAME_BOARD_Y_MAX];
+    tetris_shape_obj_t current_shape;
+    unsigned int score;
+    unsigned int level;
+    unsigned int lines;
+    unsigned int drop_frames;
+    unsigned int frames_since_drop;
+    bool game_over;
+} reference_game_t;
+
+typedef enum drop_style {
+    gravity_only,
+    soft_drop_only,
+    mixed_drops
+} drop_style_t;
+
+unsigned long failures;
+
+/**
+ * @brief xorshift32 for the script; kept apart from the game's randomizer
+ *
+ * @param state
+ * @return 32 random bits
+ */
+unsigned int script_random(unsigned int *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/** reference: the rules of main.c before game_core.c, with the drawing taken out **/
+
+/**
+ * @brief old shape_vertices
+ *
+ * @param current_shape
+ */
+void reference_vertices(tetris_shape_obj_t *current_shape) {
+    const shape_orientation_t *orientation = &shape_orientations[current_shape->shape][current_shape->orientation];
+
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        current_shape->blocks[i].x = current_shape->origin.x + orientation->blocks[i].x;
+        current_shape->blocks[i].y = current_shape->origin.y + orientation->blocks[i].y;
+    }
+}
+
+/**
+ * @brief old init_tetris_obj, plus the frame counter the game loop reset for every shape
+ *
+ * @param ref
+ * @param shape
+ */
+void reference_spawn(reference_game_t *ref, tetris_shapes_t shape) {
+    ref->current_shape.shape = shape;
+    ref->current_shape.orientation = 0;
+    ref->current_shape.origin.x = SPAWN_ORIGIN_COL;
+    ref->current_shape.origin.y = SPAWN_ORIGIN_ROW;
+    ref->current_shape.is_not_locked = true;
+    ref->current_shape.lines_moved = 0;
+    reference_vertices(&ref->current_shape);
+    ref->frames_since_drop = 0;
+}
+
+/**
+ * @brief old clear_screen_play and the start of the game loop
+ *
+ * @param ref
+ * @param shape  first shape
+ */
+void reference_init(reference_game_t *ref, tetris_shapes_t shape) {
+    for (int row = 0; row < GAME_BOARD_Y_MAX; row++) {
+        ref->board_rows[row] = BOARD_EMPTY_ROW;
+        ref->board_colors[row] = 0;
+    }
+    ref->board_rows[GAME_BOARD_Y_MAX] = BOARD_FULL_ROW;
+    ref->score = 0;
+    ref->level = 0;
+    ref->lines = 0;
+    ref->drop_frames = gravity_frames[0];
+    ref->game_over = false;
+    reference_spawn(ref, shape);
+}
+
+/**
+ * @brief old collision_probe
+ */
+bool reference_probe(const reference_game_t *ref, tetris_shapes_t shape, unsigned int orientation, int origin_col,
+                     int origin_row) {
+    const unsigned char *row_masks = shape_orientations[shape][orientation].row_masks;
+    unsigned int board_row = 0;
+    int row = 0;
+
+    if (origin_col < -(BOARD_COL_SHIFT + WALL_MARGIN)) {
+        return true;
+    }
+
+    for (int i = 0; i < SHAPE_BOX_SIZE; i++) {
+        if (row_masks[i] == 0) {
+            continue;
+        }
+
+        row = origin_row + i;
+        if ((row < GAME_BOARD_Y_MIN) || (row > GAME_BOARD_Y_MAX)) {
+            return true;
+        }
+
+        board_row = ((unsigned int) ref->board_rows[row] << WALL_MARGIN) | ((1 << WALL_MARGIN) - 1);
+        if (((unsigned int) row_masks[i] << (origin_col + BOARD_COL_SHIFT + WALL_MARGIN)) & board_row) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief old rotate_shape
+ *
+ * @param ref
+ */
+void reference_rotate(reference_game_t *ref) {
+    tetris_shape_obj_t *current_shape = &ref->current_shape;
+    unsigned int new_orientation = (current_shape->orientation + 1) % NUM_OF_ORIENTATIONS;
+    int new_col = 0;
+    int kick = 0;
+
+    if (current_shape->shape == o_shape) {
+        return;
+    }
+
+    for (kick = 0; kick < wall_kick_count[current_shape->shape]; kick++) {
+        new_col = current_shape->origin.x + wall_kicks[current_shape->shape][kick];
+
+        if (!reference_probe(ref, current_shape->shape, new_orientation, new_col, current_shape->origin.y)) {
+            break;
+        }
+    }
+
+    if (kick == wall_kick_count[current_shape->shape]) {
+        return;
+    }
+
+    current_shape->orientation = new_orientation;
+    current_shape->origin.x = new_col;
+    reference_vertices(current_shape);
+}
+
+/**
+ * @brief old lock_shape
+ *
+ * @param ref
+ */
+void reference_lock(reference_game_t *ref) {
+    tetris_shape_obj_t *current_shape = &ref->current_shape;
+    int row, col;
+
+    current_shape->is_not_locked = false;
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        row = current_shape->blocks[i].y;
+        col = current_shape->blocks[i].x;
+
+        ref->board_rows[row] |= CELL_MASK(col);
+        ref->board_colors[row] |= (current_shape->shape + 1) << (COLOR_BITS * col);
+    }
+}
+
+/**
+ * @brief old move_left, move_right and move_down; move_down locks the shape when it can not move
+ *
+ * @param ref
+ * @param movement_direction
+ */
+void reference_move(reference_game_t *ref, move_dir_t movement_direction) {
+    tetris_shape_obj_t *current_shape = &ref->current_shape;
+    int origin_col = current_shape->origin.x;
+    int origin_row = current_shape->origin.y;
+
+    switch (movement_direction) {
+        case left:
+            origin_col--;
+            break;
+        case right:
+            origin_col++;
+            break;
+        case down:
+            origin_row++;
+            break;
+    }
+
+    if (reference_probe(ref, current_shape->shape, current_shape->orientation, origin_col, origin_row)) {
+        if (movement_direction == down) {
+            reference_lock(ref);
+        }
+        return;
+    }
+
+    if (movement_direction == down) {
+        current_shape->lines_moved++;
+    }
+    current_shape->origin.x = origin_col;
+    current_shape->origin.y = origin_row;
+    reference_vertices(current_shape);
+}
+
+/**
+ * @brief old shift_rows_down
+ */
+void reference_shift_rows_down(reference_game_t *ref, int bottom_row, int row_count) {
+    for (int row = bottom_row; row >= GAME_BOARD_Y_MIN; row--) {
+        if (row - row_count >= GAME_BOARD_Y_MIN) {
+            ref->board_rows[row] = ref->board_rows[row - row_count];
+            ref->board_colors[row] = ref->board_colors[row - row_count];
+        }
+        else {
+            ref->board_rows[row] = BOARD_EMPTY_ROW;
+            ref->board_colors[row] = 0;
+        }
+    }
+}
+
+/**
+ * @brief old line_clear
+ *
+ * @param ref
+ */
+void reference_line_clear(reference_game_t *ref) {
+    int lines_to_clear[MAX_LINES_PER_CLEAR] = {99, 99, 99, 99};
+    int line_count = 0;
+
+    for (int row = 17; (row > GAME_BOARD_Y_MIN) && (line_count < MAX_LINES_PER_CLEAR); row--) {
+        if (ref->board_rows[row] == BOARD_FULL_ROW) {
+            lines_to_clear[line_count] = row;
+            line_count++;
+        }
+    }
+    if (line_count == 0) {
+        return;
+    }
+
+    for (int i = line_count - 1; i >= 0; ) {
+        int band = 1;
+
+        while ((i - band >= 0) && (lines_to_clear[i - band] == lines_to_clear[i] + band)) {
+            band++;
+        }
+        reference_shift_rows_down(ref, lines_to_clear[i] + band - 1, band);
+        i -= band;
+    }
+
+    ref->lines = bcd_add(ref->lines, line_count);
+}
+
+/**
+ * @brief one pass of the old game loop for the same input game_step got: the key presses, or the frame with
+ * its held keys and gravity; then what the loop did once the shape locked
+ *
+ * @param ref
+ * @param input          GAME_INPUT_* bits
+ * @param spawned_shape  shape the core dealt if the step locked
+ * @return true if a new shape spawned
+ */
+bool reference_step(reference_game_t *ref, unsigned int input, tetris_shapes_t spawned_shape) {
+    unsigned int level = 0;
+
+    if (input & GAME_INPUT_ROTATE) {
+        reference_rotate(ref);
+    }
+    if (input & GAME_INPUT_LEFT) {
+        reference_move(ref, left);
+    }
+    if (input & GAME_INPUT_RIGHT) {
+        reference_move(ref, right);
+    }
+
+    if (input & GAME_INPUT_FRAME) {
+        ref->frames_since_drop++;
+    }
+    if (input & GAME_INPUT_SOFT_DROP) {
+        reference_move(ref, down);
+        ref->score = bcd_add(ref->score, 1);
+        ref->frames_since_drop = 0;
+    }
+    else if ((input & GAME_INPUT_FRAME) && (ref->frames_since_drop >= ref->drop_frames)) {
+        reference_move(ref, down);
+        ref->frames_since_drop = 0;
+    }
+
+    if (ref->current_shape.is_not_locked) {
+        return false;
+    }
+
+    // the loop updated the level once per frame, before the lines of the lock were counted, and set the speed
+    // from it after spawning the next shape
+    if (ref->current_shape.lines_moved == 0) {
+        ref->game_over = true;
+    }
+    level = bcd_to_binary(ref->lines >> 4);
+    reference_line_clear(ref);
+    reference_spawn(ref, spawned_shape);
+    ref->drop_frames = gravity_frames[(level > MAX_GRAVITY_LEVEL) ? MAX_GRAVITY_LEVEL : level];
+    ref->level = ref->lines >> 4;
+    return true;
+}
+
+/** check **/
+
+/**
+ * @brief compares the core with the reference after a step and prints the first difference
+ *
+ * @param game
+ * @param ref
+ * @param step  steps since game_init
+ * @return true if they are the same
+ */
+bool same_game(const game_state_t *game, const reference_game_t *ref, unsigned long step) {
+    const tetris_shape_obj_t *shape = &game->current_shape;
+    const tetris_shape_obj_t *ref_shape = &ref->current_shape;
+
+    for (int row = 0; row <= GAME_BOARD_Y_MAX; row++) {
+        if ((game->board_rows[row] != ref->board_rows[row]) ||
+            ((row < GAME_BOARD_Y_MAX) && (game->board_colors[row] != ref->board_colors[row]))) {
+            printf("step %lu: board row %d is %04x/%08x, the old code has %04x/%08x\n", step, row,
+                   game->board_rows[row], (row < GAME_BOARD_Y_MAX) ? game->board_colors[row] : 0,
+                   ref->board_rows[row], (row < GAME_BOARD_Y_MAX) ? ref->board_colors[row] : 0);
+            return false;
+        }
+    }
+
+    if ((shape->shape != ref_shape->shape) || (shape->orientation != ref_shape->orientation) ||
+        (shape->origin.x != ref_shape->origin.x) || (shape->origin.y != ref_shape->origin.y) ||
+        (shape->lines_moved != ref_shape->lines_moved)) {
+        printf("step %lu: shape %d orientation %u at (%d, %d), the old code has shape %d orientation %u at (%d, %d)\n",
+               step, shape->shape, shape->orientation, shape->origin.x, shape->origin.y, ref_shape->shape,
+               ref_shape->orientation, ref_shape->origin.x, ref_shape->origin.y);
+        return false;
+    }
+
+    if ((game->score != ref->score) || (game->lines != ref->lines) || (game->level != ref->level) ||
+        (game->drop_frames != ref->drop_frames) || (game->frames_since_drop != ref->frames_since_drop) ||
+        (game->game_over != ref->game_over)) {
+        printf("step %lu: score %x lines %x level %x drop %u/%u over %d, the old code has %x %x %x %u/%u %d\n", step,
+               game->score, game->lines, game->level, game->frames_since_drop, game->drop_frames, game->game_over,
+               ref->score, ref->lines, ref->level, ref->frames_since_drop, ref->drop_frames, ref->game_over);
+        return false;
+    }
+
+    return true;
+}
+
+/** script **/
+
+/**
+ * @brief how good the board of a game is for the player; more is better
+ *
+ * @param game  right after a lock
+ */
+int placement_value(const game_state_t *game) {
+    int aggregate_height = 0;
+    int holes = 0;
+    int bumpiness = 0;
+    int previous_height = 0;
+
+    if (game->game_over) {
+        return GAME_OVER_VALUE;
+    }
+
+    for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
+        int top = GAME_BOARD_Y_MAX;
+
+        for (int row = GAME_BOARD_Y_MAX - 1; row >= GAME_BOARD_Y_MIN; row--) {
+            if (game->board_rows[row] & CELL_MASK(col)) {
+                top = row;
+            }
+        }
+        for (int row = top + 1; row < GAME_BOARD_Y_MAX; row++) {
+            if (!(game->board_rows[row] & CELL_MASK(col))) {
+                holes++;
+            }
+        }
+
+        aggregate_height += GAME_BOARD_Y_MAX - top;
+        if (col > 0) {
+            bumpiness += (GAME_BOARD_Y_MAX - top > previous_height) ? (GAME_BOARD_Y_MAX - top - previous_height)
+                                                                    : (previous_height - (GAME_BOARD_Y_MAX - top));
+        }
+        previous_height = GAME_BOARD_Y_MAX - top;
+    }
+
+    return LINE_WEIGHT * (int) game->line_count - HEIGHT_WEIGHT * aggregate_height - HOLE_WEIGHT * holes -
+           BUMP_WEIGHT * bumpiness;
+}
+
+/**
+ * @brief picks the rotation and column the falling shape goes to
+ *
+ * @param game
+ * @param random     script randomizer
+ * @param rotations  number of GAME_INPUT_ROTATE
+ * @param column     origin column to move to
+ */
+void pick_placement(const game_state_t *game, unsigned int *random, unsigned int *rotations, int *column) {
+    int best_value = GAME_OVER_VALUE - 1;
+
+    if (script_random(random) % RANDOM_PLACEMENT == 0) {
+        *rotations = script_random(random) % NUM_OF_ORIENTATIONS;
+        *column = (int) (script_random(random) % GAME_BOARD_X_MAX) - 1;
+        return;
+    }
+
+    for (unsigned int r = 0; r < NUM_OF_ORIENTATIONS; r++) {
+        for (int col = -2; col < GAME_BOARD_X_MAX; col++) {
+            game_state_t trial = *game;
+            int value = 0;
+
+            for (unsigned int i = 0; i < r; i++) {
+                game_step(&trial, GAME_INPUT_ROTATE);
+            }
+            while ((trial.current_shape.origin.x > col) && (game_step(&trial, GAME_INPUT_LEFT) & GAME_EVENT_MOVED)) {
+            }
+            while ((trial.current_shape.origin.x < col) && (game_step(&trial, GAME_INPUT_RIGHT) & GAME_EVENT_MOVED)) {
+            }
+            if (trial.current_shape.origin.x != col) {
+                continue;
+            }
+
+            game_step(&trial, GAME_INPUT_HARD_DROP);
+            value = placement_value(&trial);
+            if (value > best_value) {
+                best_value = value;
+                *rotations = r;
+                *column = col;
+            }
+        }
+    }
+}
+
+/**
+ * @brief steps the core and the reference with the same input
+ *
+ * @return GAME_EVENT_* bits of the core; 0 and a failure if they no longer match
+ */
+unsigned int step_both(game_state_t *game, reference_game_t *ref, unsigned int input, unsigned long *steps) {
+    unsigned int events = game_step(game, input);
+    bool spawned = reference_step(ref, input, game->current_shape.shape);
+
+    (*steps)++;
+    if (spawned != ((events & GAME_EVENT_SPAWNED) != 0)) {
+        printf("step %lu: the core %s a shape, the old code %s\n", *steps,
+               (events & GAME_EVENT_SPAWNED) ? "spawned" : "did not spawn", spawned ? "did" : "did not");
+        failures++;
+        return 0;
+    }
+    if (!same_game(game, ref, *steps)) {
+        failures++;
+        return 0;
+    }
+
+    return events | GAME_EVENT_MOVED; // never 0 while they match
+}
+
+/**
+ * @brief plays one scripted game on the core and the reference
+ *
+ * @param seed      seeds the core's shapes and the script
+ * @param stack_up  every shape soft drops where it spawns
+ * @param lines     lines cleared, binary
+ * @return true if the game reached game over
+ */
+bool play_game(unsigned int seed, bool stack_up, unsigned int *lines) {
+    game_state_t game;
+    reference_game_t ref;
+    unsigned int random = seed;
+    unsigned long steps = 0;
+    unsigned long failures_before = failures;
+    unsigned int pieces = 0;
+    unsigned int events = 0;
+
+    game_init(&game, seed);
+    reference_init(&ref, game.current_shape.shape);
+
+    while (!game.game_over && (pieces < MAX_PIECES) && (failures == failures_before)) {
+        unsigned int rotations = 0;
+        int column = SPAWN_ORIGIN_COL;
+        drop_style_t style = stack_up ? soft_drop_only : (drop_style_t) (script_random(&random) % 3);
+        unsigned int input = 0;
+
+        if (!stack_up) {
+            pick_placement(&game, &random, &rotations, &column);
+        }
+
+        // rotations are key presses; the moves are held keys, one column per frame
+        for (unsigned int i = 0; i < rotations; i++) {
+            step_both(&game, &ref, GAME_INPUT_ROTATE, &steps);
+        }
+
+        do {
+            input = GAME_INPUT_FRAME;
+            if (game.current_shape.origin.x > column) {
+                input |= GAME_INPUT_LEFT;
+            }
+            else if (game.current_shape.origin.x < column) {
+                input |= GAME_INPUT_RIGHT;
+            }
+
+            if ((style == soft_drop_only) || ((style == mixed_drops) && (script_random(&random) & 1))) {
+                // a soft drop key press between frames, or a held down key on the frame
+                if (script_random(&random) & 1) {
+                    events = step_both(&game, &ref, GAME_INPUT_SOFT_DROP, &steps);
+                    if (!events || (events & GAME_EVENT_LOCKED)) {
+                        break;
+                    }
+                }
+                else {
+                    input |= GAME_INPUT_SOFT_DROP;
+                }
+            }
+
+            events = step_both(&game, &ref, input, &steps);
+        } while (events && !(events & GAME_EVENT_LOCKED));
+
+        pieces++;
+    }
+
+    *lines = bcd_to_binary(game.lines);
+    printf("game %08x pieces %3u lines %3u level %2x score %6x steps %7lu %s\n", seed, pieces, *lines, game.level,
+           game.score, steps, (failures == failures_before) ? "ok" : "FAIL");
+    return game.game_over;
+}
+
+int main() {
+    const unsigned int seeds[SCRIPTED_GAMES] = {1, 2, 3, 42, 0xBD0BC5FE, 0x12345678, 0xDEADBEEF, 0x80000000};
+    unsigned int lines = 0;
+    unsigned int total_lines = 0;
+    unsigned int games_over = 0;
+    game_state_t game;
+
+    for (int i = 0; i < SCRIPTED_GAMES; i++) {
+        games_over += play_game(seeds[i], false, &lines);
+        total_lines += lines;
+    }
+    games_over += play_game(7, true, &lines);
+
+    if (total_lines < MIN_TOTAL_LINES) {
+        printf("FAIL: the scripted games cleared %u lines, under %d\n", total_lines, MIN_TOTAL_LINES);
+        failures++;
+    }
+    if (games_over == 0) {
+        printf("FAIL: no scripted game reached game over\n");
+        failures++;
+    }
+
+    // the scripted games stay under level 10; levels of three digits, 1000 lines and more, fall at the top speed
+    game.level = 0x105;
+    update_game_speed(&game);
+    if ((bcd_to_binary(game.level) != 105) || (game.drop_frames != gravity_frames[MAX_GRAVITY_LEVEL])) {
+        printf("FAIL: level %x decodes to %u and drops every %u frames\n", game.level, bcd_to_binary(game.level),
+               game.drop_frames);
+        failures++;
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
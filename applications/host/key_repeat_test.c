@@ -0,0 +1,195 @@
+/**
+* Brief:
+* drives key_repeat.c through the timelines the game loop gives it and checks the frames a held key acts on.
+* One key with the delay and rate of left/right in main.c (DAS_TICKS, ARR_TICKS); times are mtime ticks
+* at 50 MHz and 60 frames per second.
+*
+* Timelines:
+*   steady    the key is held for 60 frames at an exact frame rate, with mtime wrapping between the press and the
+*             first repeat: it acts on the press, after the delay and then every rate
+*   jittered  the same with each frame read up to a fifth of a frame early or late: the same number of actions,
+*             each at most one frame after its steady frame
+*   stall     the loop stops for 100 frames while the key repeats: one action when it comes back, then the rate
+*             starts again from there instead of making up the missed repeats
+*   tap       the key goes down and up between two frames: it acts once, on the press event, and the next tap
+*             acts again
+*   early     KEY_STATE_REG shows the key down a frame before its press event comes out of the queue: it acts
+*             once, on the frame, and the press event that follows does nothing
+*
+* usage: key_repeat_test
+* prints one line per timeline; exits with 1 if any check failed
+**/
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "key_repeat.h"
+
+/** times of main.c **/
+#define TICKS_PER_FRAME (50000000 / 60)
+#define DAS_FRAMES 16
+#define ARR_FRAMES 6
+#define DAS_TICKS (DAS_FRAMES * TICKS_PER_FRAME)
+#define ARR_TICKS (ARR_FRAMES * TICKS_PER_FRAME)
+
+#define KEY_BIT 0x2     // KEY_STATE_A
+#define HELD_FRAMES 60
+#define STALL_FRAMES 100
+#define WRAP_FRAMES 10  // mtime wraps this many frames after the press
+
+unsigned long failures;
+
+/**
+ * @brief counts a failed check and prints it
+ *
+ * @param passed
+ * @param format  printf format of what was checked
+ */
+void check(bool passed, const char *format, ...) {
+    va_list args;
+
+    if (passed) {
+        return;
+    }
+    failures++;
+    fprintf(stderr, "FAIL: ");
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fprintf(stderr, "\n");
+}
+
+/**
+ * @brief prints the result of a timeline
+ *
+ * @param name
+ * @param failures_before
+ */
+void report(const char *name, unsigned long failures_before) {
+    printf("%-9s %s\n", name, (failures == failures_before) ? "ok" : "FAIL");
+}
+
+/**
+ * @brief a repeat of KEY_BIT in its idle state
+ */
+key_repeat_t new_repeat() {
+    key_repeat_t repeat = {KEY_BIT, DAS_TICKS, ARR_TICKS, false, 0};
+
+    return repeat;
+}
+
+/**
+ * @brief the frame a held key acts on for the nth time after its press, at an exact frame rate
+ *
+ * @param n  1 = first repeat
+ */
+unsigned int steady_frame(unsigned int n) {
+    return DAS_FRAMES + (n - 1) * ARR_FRAMES;
+}
+
+/**
+ * @brief holds the key from a press event at start for HELD_FRAMES frames, then lets it go
+ *
+ * @param start   mtime of the press
+ * @param jitter  frame reads are moved by up to a fifth of a frame
+ * @param acted   frames the key acted on, after the press
+ * @return number of frames in acted
+ */
+unsigned int hold(unsigned int start, bool jitter, unsigned int *acted) {
+    key_repeat_t repeat = new_repeat();
+    unsigned int count = 0;
+    unsigned int now = 0;
+
+    check(key_repeat_press(&repeat, start), "the press did not act");
+    for (unsigned int frame = 1; frame <= HELD_FRAMES; frame++) {
+        now = start + frame * TICKS_PER_FRAME;
+        if (jitter) {
+            // -2/10 to +2/10 of a frame, in no simple order
+            now += (int)((frame * 7) % 5 - 2) * (TICKS_PER_FRAME / 10);
+        }
+        if (key_repeat_step(&repeat, KEY_BIT, now)) {
+            acted[count++] = frame;
+        }
+    }
+
+    check(!key_repeat_step(&repeat, 0, now + TICKS_PER_FRAME), "the key acted on the frame it was let go");
+    check(!repeat.held, "the key is still held after it was let go");
+    return count;
+}
+
+int main() {
+    unsigned int steady[HELD_FRAMES];
+    unsigned int jittered[HELD_FRAMES];
+    unsigned int steady_count = 0;
+    unsigned int jittered_count = 0;
+    unsigned int expected_count = (HELD_FRAMES - DAS_FRAMES) / ARR_FRAMES + 1;
+    unsigned int wrap_start = 0u - WRAP_FRAMES * TICKS_PER_FRAME;
+    unsigned long before = 0;
+    key_repeat_t repeat;
+    unsigned int now = 0;
+    unsigned int frame = 0;
+
+    before = failures;
+    steady_count = hold(wrap_start, false, steady);
+    check(steady_count == expected_count, "%u repeats, expected %u", steady_count, expected_count);
+    for (unsigned int i = 0; i < steady_count && i < expected_count; i++) {
+        check(steady[i] == steady_frame(i + 1), "repeat %u on frame %u, expected %u", i + 1, steady[i],
+              steady_frame(i + 1));
+    }
+    report("steady", before);
+
+    before = failures;
+    jittered_count = hold(wrap_start, true, jittered);
+    check(jittered_count == expected_count, "%u repeats, expected %u", jittered_count, expected_count);
+    for (unsigned int i = 0; i < jittered_count && i < expected_count; i++) {
+        check(jittered[i] - steady_frame(i + 1) <= 1, "repeat %u on frame %u, expected %u or %u", i + 1,
+              jittered[i], steady_frame(i + 1), steady_frame(i + 1) + 1);
+    }
+    report("jittered", before);
+
+    // held into its repeats, then no frame for STALL_FRAMES
+    before = failures;
+    repeat = new_repeat();
+    key_repeat_press(&repeat, 0);
+    for (frame = 1; frame <= steady_frame(2); frame++) {
+        key_repeat_step(&repeat, KEY_BIT, frame * TICKS_PER_FRAME);
+    }
+    frame += STALL_FRAMES;
+    check(key_repeat_step(&repeat, KEY_BIT, frame * TICKS_PER_FRAME), "no action on the frame after the stall");
+    for (unsigned int i = 1; i < ARR_FRAMES; i++) {
+        check(!key_repeat_step(&repeat, KEY_BIT, (frame + i) * TICKS_PER_FRAME),
+              "action %u frames after the stall; the missed repeats were made up", i);
+    }
+    check(key_repeat_step(&repeat, KEY_BIT, (frame + ARR_FRAMES) * TICKS_PER_FRAME),
+          "no action one rate after the stall");
+    report("stall", before);
+
+    // down and up half way between frames 0 and 1, twice
+    before = failures;
+    repeat = new_repeat();
+    for (int tap = 0; tap < 2; tap++) {
+        now = (2 * tap) * TICKS_PER_FRAME;
+        check(key_repeat_press(&repeat, now + TICKS_PER_FRAME / 2), "tap %d: the press did not act", tap + 1);
+        check(!key_repeat_step(&repeat, 0, now + TICKS_PER_FRAME), "tap %d: acted after the key went up", tap + 1);
+        check(!key_repeat_step(&repeat, 0, now + 2 * TICKS_PER_FRAME), "tap %d: acted with the key up", tap + 1);
+    }
+    report("tap", before);
+
+    // the frame reads the bitmap before the loop gets to the press event; the delay counts from that frame
+    before = failures;
+    repeat = new_repeat();
+    check(key_repeat_step(&repeat, KEY_BIT, TICKS_PER_FRAME), "the frame that saw the key down did not act");
+    check(!key_repeat_press(&repeat, TICKS_PER_FRAME + TICKS_PER_FRAME / 2), "the late press event acted again");
+    for (frame = 2; frame <= DAS_FRAMES; frame++) {
+        check(!key_repeat_step(&repeat, KEY_BIT, frame * TICKS_PER_FRAME), "repeat on frame %u, before the delay",
+              frame);
+    }
+    check(key_repeat_step(&repeat, KEY_BIT, (DAS_FRAMES + 1) * TICKS_PER_FRAME),
+          "no repeat one delay after the frame that saw the key");
+    report("early", before);
+
+    if (failures != 0) {
+        fprintf(stderr, "%lu checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,324 @@
+/**
+* Brief:
+* counts the bus traffic of each drawing primitive of main.c against mmio_model.c. Every primitive runs
+* once from a scripted screen and board state; its bus writes, bus reads (mtime not counted) and model
+* cycles (bus accesses, engine stalls and frames waited for) are compared with the limits of a threshold file,
+* so a change that blows up the register traffic of a primitive fails the run.
+*
+* usage: mmio_bench [-t thresholds] [-o results.csv]
+* thresholds: one "<primitive> <max_writes> <max_reads> <max_cycles>" per line; '#' starts a comment
+* results: CSV, one line per primitive with the stall cycles behind the row shift engine; exits with 1 if any
+*          primitive is over its limits
+**/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "mmio_model.h"
+#include "game_core.h"
+
+#undef main // only main.c is renamed to firmware_main
+
+#ifndef MMIO_THRESHOLDS
+#define MMIO_THRESHOLDS "mmio_thresholds.txt"
+#endif
+
+#define MAX_PRIMITIVES 32
+#define MAX_NAME 32
+#define TILE_REG 0x80001524
+
+typedef struct primitive_result {
+    char name[MAX_NAME];
+    unsigned long writes;
+    unsigned long reads;
+    unsigned long long cycles;
+    unsigned long stall_cycles; // part of cycles the writes were held off by the row shift engine; not limited
+    bool limited;               // false if the threshold file has no line for it
+    unsigned long max_writes;
+    unsigned long max_reads;
+    unsigned long long max_cycles;
+} primitive_result_t;
+
+/** main.c **/
+extern int shape_color[NUM_OF_TETRIS_SHAPES];
+void draw_menu_cursor(bool visible);
+void draw_tetris_game_background();
+void draw_block(int virtual_row, int virtual_col, int color);
+void update_block(int virtual_row, int virtual_col, int color);
+void clear_screen_play();
+void draw_game_events(game_state_t *game, unsigned int events);
+void init_interrupts();
+
+primitive_result_t results[MAX_PRIMITIVES];
+unsigned int result_count;
+mmio_counters_t start;
+
+// bottom rows of the line clear boards, top row first; '.' is empty, letters are the shape of the block.
+// Column 9 is left open for an upright I shape resting on the floor, so the full rows clear when it locks
+const char *line_clear_boards[MAX_LINES_PER_CLEAR][BLOCKS_PER_SHAPE] = {
+    {"JJ........", "LLL.......", "ZZ.T......", "IIIIOOSST."},
+    {"JJ........", "LLL.......", "IIIIOOSST.", "TTLLJJZZS."},
+    {"JJ........", "IIIIOOSST.", "TTLLJJZZS.", "OOSSTTLLJ."},
+    {"IIIIOOSST.", "TTLLJJZZS.", "OOSSTTLLJ.", "ZZIIIISSO."}
+};
+
+/**
+ * @brief starts counting the bus traffic of a primitive
+ */
+void begin_measure() {
+    start = mmio_counters;
+}
+
+/**
+ * @brief stores the bus traffic since begin_measure() under the name of the primitive
+ *
+ * @param name
+ */
+void end_measure(const char *name) {
+    primitive_result_t *result = NULL;
+
+    if (result_count == MAX_PRIMITIVES) {
+        fprintf(stderr, "too many primitives, dropping %s\n", name);
+        return;
+    }
+
+    result = &results[result_count++];
+    snprintf(result->name, MAX_NAME, "%s", name);
+    result->writes = mmio_counters.writes - start.writes;
+    result->reads = mmio_counters.reads - start.reads;
+    result->cycles = mmio_counters.cycles - start.cycles;
+    result->stall_cycles = mmio_counters.stall_cycles - start.stall_cycles;
+}
+
+/**
+ * @brief game with an empty board whose first shape is drawn on a freshly cleared play area
+ *
+ * @param game
+ */
+void new_game(game_state_t *game) {
+    clear_screen_play();
+    game_init(game, 1);
+    draw_game_events(game, GAME_EVENT_SPAWNED);
+}
+
+/**
+ * @brief fills the bottom rows of the board and draws them
+ *
+ * @param game
+ * @param rows       top row first
+ * @param row_count
+ */
+void load_board(game_state_t *game, const char *rows[], int row_count) {
+    const char *shape_letters = "IJLOSTZ";
+
+    for (int i = 0; i < row_count; i++) {
+        int row = GAME_BOARD_Y_MAX - row_count + i;
+
+        for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
+            const char *letter = strchr(shape_letters, rows[i][col]);
+
+            if (rows[i][col] == '.' || letter == NULL) {
+                continue;
+            }
+            game->board_rows[row] |= CELL_MASK(col);
+            game->board_colors[row] |= (unsigned int) (letter - shape_letters + 1) << (COLOR_BITS * col);
+            update_block(row, col, shape_color[letter - shape_letters]);
+        }
+    }
+}
+
+/**
+ * @brief replaces the falling shape and draws it where it was put
+ *
+ * @param game
+ * @param shape
+ * @param orientation
+ * @param origin_col
+ * @param origin_row
+ */
+void place_shape(game_state_t *game, tetris_shapes_t shape, unsigned int orientation, int origin_col, int origin_row) {
+    tetris_shape_obj_t *current_shape = &game->current_shape;
+
+    current_shape->shape = shape;
+    current_shape->orientation = orientation;
+    current_shape->origin.x = origin_col;
+    current_shape->origin.y = origin_row;
+    current_shape->is_not_locked = true;
+    current_shape->lines_moved = 1; // a shape that never moved locks as game over
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        current_shape->blocks[i].x = origin_col + shape_orientations[shape][orientation].blocks[i].x;
+        current_shape->blocks[i].y = origin_row + shape_orientations[shape][orientation].blocks[i].y;
+    }
+
+    draw_game_events(game, GAME_EVENT_MOVED);
+}
+
+/**
+ * @brief runs one game_step and draws what it changed, the way the game loop of main.c does
+ *
+ * @param name
+ * @param game
+ * @param input
+ */
+void measure_step(const char *name, game_state_t *game, unsigned int input) {
+    begin_measure();
+    draw_game_events(game, game_step(game, input));
+    end_measure(name);
+}
+
+/**
+ * @brief runs every primitive from its scripted state
+ */
+void run_primitives() {
+    game_state_t game;
+    char name[MAX_NAME];
+
+    // the line clear animation waits for vertical blanks
+    init_interrupts();
+
+    // main menu cursor; one blink is an erase and a draw
+    WRITE_GPIO(TILE_REG, 0); // the menu covers the play area
+    begin_measure();
+    draw_menu_cursor(false);
+    end_measure("menu_cursor_erase");
+    begin_measure();
+    draw_menu_cursor(true);
+    end_measure("menu_cursor_draw");
+
+    begin_measure();
+    draw_tetris_game_background();
+    end_measure("draw_tetris_game_background");
+
+    begin_measure();
+    clear_screen_play();
+    end_measure("clear_screen_play");
+
+    begin_measure();
+    draw_block(GAME_BOARD_Y_MAX - 1, 0, shape_color[t_shape]);
+    end_measure("draw_block");
+
+    // T shape in the middle of a board with a few rows of blocks under it
+    new_game(&game);
+    load_board(&game, line_clear_boards[0], BLOCKS_PER_SHAPE);
+    place_shape(&game, t_shape, 0, SPAWN_ORIGIN_COL, 6);
+    measure_step("move_left", &game, GAME_INPUT_LEFT);
+    measure_step("move_right", &game, GAME_INPUT_RIGHT);
+    measure_step("move_down", &game, GAME_INPUT_SOFT_DROP);
+    measure_step("rotate_shape", &game, GAME_INPUT_ROTATE);
+
+    // an upright I shape (orientation 1, blocks in column 2 of its box) resting on the floor in column 9;
+    // one soft drop locks it, clears the full rows and spawns the next shape
+    for (int lines = 1; lines <= MAX_LINES_PER_CLEAR; lines++) {
+        new_game(&game);
+        load_board(&game, line_clear_boards[lines - 1], BLOCKS_PER_SHAPE);
+        place_shape(&game, i_shape, 1, GAME_BOARD_X_MAX - 3, GAME_BOARD_Y_MAX - BLOCKS_PER_SHAPE);
+        snprintf(name, MAX_NAME, "line_clear_%d", lines);
+        measure_step(name, &game, GAME_INPUT_SOFT_DROP);
+        if (game.line_count != (unsigned int) lines) {
+            fprintf(stderr, "%s: cleared %u lines\n", name, game.line_count);
+            exit(1);
+        }
+    }
+}
+
+/**
+ * @brief reads the limits of each primitive; see the top of this file
+ *
+ * @return 0, or -1 if the file could not be read
+ */
+int load_thresholds(const char *path) {
+    FILE *file = fopen(path, "r");
+    char line[256];
+    char name[MAX_NAME];
+    unsigned long max_writes, max_reads;
+    unsigned long long max_cycles;
+
+    if (file == NULL) {
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char *comment = strchr(line, '#');
+        bool found = false;
+
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+        if (sscanf(line, "%31s %lu %lu %llu", name, &max_writes, &max_reads, &max_cycles) != 4) {
+            continue;
+        }
+
+        for (unsigned int i = 0; i < result_count; i++) {
+            if (strcmp(results[i].name, name) == 0) {
+                results[i].limited = true;
+                results[i].max_writes = max_writes;
+                results[i].max_reads = max_reads;
+                results[i].max_cycles = max_cycles;
+                found = true;
+            }
+        }
+        if (!found) {
+            fprintf(stderr, "%s: no primitive named %s\n", path, name);
+        }
+    }
+    return fclose(file);
+}
+
+int main(int argc, char **argv) {
+    const char *thresholds_path = MMIO_THRESHOLDS;
+    const char *results_path = NULL;
+    FILE *output = stdout;
+    unsigned int failed = 0;
+    int option = 0;
+
+    while ((option = getopt(argc, argv, "t:o:")) != -1) {
+        switch (option) {
+            case 't':
+                thresholds_path = optarg;
+                break;
+            case 'o':
+                results_path = optarg;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-t thresholds] [-o results.csv]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    run_primitives();
+
+    if (load_thresholds(thresholds_path) != 0) {
+        perror(thresholds_path);
+        return 1;
+    }
+
+    if (results_path != NULL) {
+        output = fopen(results_path, "w");
+        if (output == NULL) {
+            perror(results_path);
+            return 1;
+        }
+    }
+
+    fprintf(output, "primitive,writes,reads,cycles,stall_cycles,max_writes,max_reads,max_cycles,status\n");
+    for (unsigned int i = 0; i < result_count; i++) {
+        primitive_result_t *result = &results[i];
+        bool over = result->limited && ((result->writes > result->max_writes) ||
+                    (result->reads > result->max_reads) || (result->cycles > result->max_cycles));
+
+        fprintf(output, "%s,%lu,%lu,%llu,%lu,%lu,%lu,%llu,%s\n", result->name, result->writes, result->reads,
+                result->cycles, result->stall_cycles, result->max_writes, result->max_reads, result->max_cycles,
+                !result->limited ? "unlimited" : (over ? "over" : "ok"));
+        if (over) {
+            fprintf(stderr, "%s over its limits: %lu writes, %lu reads, %llu cycles\n",
+                    result->name, result->writes, result->reads, result->cycles);
+            failed++;
+        }
+    }
+
+    if (output != stdout) {
+        fclose(output);
+    }
+    return (failed > 0) ? 1 : 0;
+}
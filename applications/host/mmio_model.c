@@ -0,0 +1,912 @@
+/**
+* Brief:
+* in-process model of the peripherals main.c talks to, so the firmware runs unchanged on a PC.
+*   vga_top: register file, the two game_ram pages (palette indexes) with their palettes and the page flip,
+*            streaming, the play area
+*            tile map with its row shift engine (vertical blank only), flashing rows and the falling shape and its ghost drawn over it,
+*            the score/level/lines digits and the next shape sprite (sections on when RAM_REG bit 31 is set),
+*            the vertical blank count and interrupt
+*   keyboard_top: key event FIFO and held keys, fed from a key script
+*   syscon mtime and the PIC: enough to run the game loop and deliver the keyboard interrupt
+*   uart16550: the transmit FIFO emptied at 115200 baud and its THRE interrupt; characters go to the UART file
+* Time only moves on bus accesses and wfi: every load or store costs BUS_ACCESS_CYCLES core clocks, writes
+* to vga_top wait for the block and row shift engines like the real ack does, and wfi skips ahead to the next
+* interrupt (the vertical blank, a key script event or the UART transmit FIFO going empty). mmio_frame_done is called every 1/60 s of model time; the vertical blank follows it.
+*
+* key script: one "<frame> <key> press|release" per line, keys are w a s d enter space; '#' starts a comment
+* trace: every vga_top access as "<cycle> w <register> <hex value>" or "<cycle> r <register>", where
+*        register is wb_adr_i[5:2]; replayed against the RTL by src/VeeRwolf/Peripherals/vga/sim
+**/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mmio_model.h"
+#include "keyboard_keys.h"
+
+void trap_handler();
+void move_tiles();
+
+/** address map **/
+#define VGA_BASE      0x80001500
+#define VGA_SIZE      0x40
+#define KEY_STATE_REG 0x80001708
+#define KEY_EVENT_REG 0x8000170C
+#define MTIME_REG     0x80001020
+#define MTIMEH_REG    0x80001024
+#define UART_BASE     0x80002000
+#define UART_SIZE     0x20
+#define PIC_BASE      0xF00C0000
+#define PIC_MEIE(id)  (PIC_BASE + 0x2000 + ((id) << 2))
+
+// vga_top registers; wb_adr_i[5:2]
+#define VGA_RAM        0
+#define VGA_RGB        1
+#define VGA_NEXT_SHAPE 2
+#define VGA_SCORE      3
+#define VGA_LEVEL      4
+#define VGA_LINES      5
+#define VGA_PIECE      6
+#define VGA_TILE       9
+#define VGA_STREAM     10
+#define VGA_ROW_SHIFT  11
+#define VGA_PALETTE    12
+#define VGA_FLASH_ROWS 13
+#define VGA_PAGE       14
+#define VGA_FRAME      15
+
+// uart16550 registers; wb_adr_i[4:2]
+#define UART_THR 0 // divisor latch low byte while LCR bit 7 is set
+#define UART_IER 1 // divisor latch high byte while LCR bit 7 is set
+#define UART_IIR 2
+#define UART_LCR 3
+#define UART_LSR 5
+#define UART_IER_THRE 0x02
+#define UART_LCR_DLAB 0x80
+
+// control and status registers
+#define MSTATUS 0x300
+#define MIE     0x304
+#define MEIHAP  0xFC8
+#define MCAUSE  0x342
+#define MCAUSE_EXTERNAL_INTERRUPT 0x8000000B
+#define MSTATUS_MIE 0x00000008
+#define MIE_MEIE    0x00000800
+#define UART_IRQ_ID 1
+#define PS2_IRQ_ID  5
+#define VGA_IRQ_ID  6
+
+/** timing **/
+#define CLOCK_FREQUENCY 50000000
+#define FRAME_RATE 60
+#define TICKS_PER_FRAME (CLOCK_FREQUENCY / FRAME_RATE)
+#define VBLANK_TICKS (TICKS_PER_FRAME * 28 / 628) // the last 28 of the 628 lines of dtg.v; a frame starts with it
+#define BUS_ACCESS_CYCLES 4   // core clocks for one load or store to a peripheral; a rough figure, not measured
+#define UART_CHAR_CYCLES (CLOCK_FREQUENCY / 115200 * 10) // start, 8 data and stop bits
+
+/** screen; in 160x144 game pixels **/
+#define SCREEN_WIDTH  160
+#define SCREEN_HEIGHT 144
+#define PLAY_AREA_ROW 0
+#define PLAY_AREA_COL 16
+#define BLOCK_PIXELS  8
+#define PLAY_AREA_BLOCKS_WIDE 10
+#define PLAY_AREA_BLOCKS_TALL 18
+#define NUM_OF_TILES (PLAY_AREA_BLOCKS_WIDE * PLAY_AREA_BLOCKS_TALL)
+#define SCORE_ROW  80
+#define LEVEL_ROW  104
+#define LINES_ROW  128
+#define DIGITS_COL 112
+#define NUM_OF_DIGITS 6
+#define NEXT_SHAPE_ROW  24
+#define NEXT_SHAPE_COL  120
+#define NEXT_SHAPE_SIZE 32
+#define SPRITE_PIXEL    4  // each sprite pixel is 4x4 game pixels
+#define GRAY_TILE 8
+#define GRAY  0x555
+#define PALETTE_SIZE 16
+#define NUM_OF_PAGES 2
+#define WHITE 0xFFF
+#define BLACK 0x000
+
+#define KEY_FIFO_SIZE 16
+#define MAX_SCRIPT_EVENTS 4096
+
+typedef struct key_script_event {
+    unsigned long long time;       // model time the key goes down or up
+    unsigned short int key_event;  // scancode | KEY_BREAK for a release
+    unsigned int key_state;        // KEY_STATE_* bit of the key
+} key_script_event_t;
+
+/** vga_top **/
+unsigned int position_register, rgb_register, next_shape_register, score_register, level_register, lines_register;
+unsigned int tile_register, stream_register, shift_register, palette_register, flash_register;
+unsigned int page_register, frame_register, piece_register;
+unsigned int frame_count;  // vertical blanks, 24 bits like the RTL
+bool vblank_pending;
+unsigned int cpu_row, cpu_col, cpu_color_index;
+unsigned int scanned_page; // page on screen; takes page_register bit 4 at the end of a frame
+unsigned short int palette[NUM_OF_PAGES][PALETTE_SIZE];
+bool stream_first;
+unsigned char game_ram[NUM_OF_PAGES][SCREEN_HEIGHT * SCREEN_WIDTH]; // palette indexes
+unsigned char tiles[NUM_OF_TILES];
+unsigned long long shift_done; // cycle the row shift engine goes idle
+bool shift_waiting;            // a shift asked for during a frame; the tiles move in the next vertical blank
+
+/** keyboard_top **/
+unsigned short int key_fifo[KEY_FIFO_SIZE];
+unsigned int key_fifo_head, key_fifo_tail;
+bool key_fifo_overflow;
+unsigned int keys_held;
+key_script_event_t key_script[MAX_SCRIPT_EVENTS];
+unsigned int key_script_length, key_script_next;
+
+/** uart16550 **/
+FILE *uart_file = NULL;
+unsigned int uart_ier, uart_lcr;
+unsigned long long uart_next_start;  // cycle the transmitter can start the next character
+unsigned long long uart_empty_time;  // cycle the transmit FIFO goes empty (THRE status)
+bool uart_thre_int;                  // THRE interrupt on and the FIFO empty, as of the last uart_update()
+bool uart_thre_pending;
+
+/** core **/
+unsigned int mstatus, mie;
+bool uart_irq_enabled, keyboard_irq_enabled, vga_irq_enabled;
+bool in_trap;
+
+/** frames **/
+FILE *trace_file = NULL;
+unsigned long frame;
+mmio_counters_t mmio_counters;
+void (*mmio_frame_done)(unsigned long frame) = NULL;
+
+// 8x8 images, bit 7 is the leftmost pixel (chars.v and tetris_sprites.sv)
+const unsigned char digit_glyphs[16][8] = {
+    {0x7C, 0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0x7C, 0x00},
+    {0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0xFC, 0x00},
+    {0x78, 0xCC, 0x0C, 0x38, 0x60, 0xCC, 0xFC, 0x00},
+    {0x78, 0xCC, 0x0C, 0x38, 0x0C, 0xCC, 0x78, 0x00},
+    {0x1C, 0x3C, 0x6C, 0xCC, 0xFE, 0x0C, 0x1E, 0x00},
+    {0xFC, 0xC0, 0xF8, 0x0C, 0x0C, 0xCC, 0x78, 0x00},
+    {0x38, 0x60, 0xC0, 0xF8, 0xCC, 0xCC, 0x78, 0x00},
+    {0xFC, 0xCC, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x00},
+    {0x78, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0x78, 0x00},
+    {0x78, 0xCC, 0xCC, 0x7C, 0x0C, 0x18, 0x70, 0x00},
+    {0x30, 0x78, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0x00},
+    {0xFC, 0x66, 0x66, 0x7C, 0x66, 0x66, 0xFC, 0x00},
+    {0x3C, 0x66, 0xC0, 0xC0, 0xC0, 0x66, 0x3C, 0x00},
+    {0xF8, 0x6C, 0x66, 0x66, 0x66, 0x6C, 0xF8, 0x00},
+    {0xFE, 0x62, 0x68, 0x78, 0x68, 0x62, 0xFE, 0x00},
+    {0xFE, 0x62, 0x68, 0x78, 0x68, 0x60, 0xF0, 0x00}
+};
+
+const unsigned char shape_sprites[8][8] = {
+    {0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0},
+    {0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03},
+    {0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00},
+    {0x00, 0x00, 0x3C, 0x3C, 0xF0, 0xF0, 0x00, 0x00},
+    {0x00, 0x00, 0xFC, 0xFC, 0x30, 0x30, 0x00, 0x00},
+    {0x00, 0x00, 0xF0, 0xF0, 0x3C, 0x3C, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+};
+
+// block_template.sv; 2 bits per pixel, bits 15:14 are the leftmost pixel
+const unsigned short int block_template[8] = {
+    0x5555, 0x6801, 0x6551, 0x4691, 0x4691, 0x4551, 0x4001, 0x5555
+};
+#define TEMPLATE_OUTLINE   1
+#define TEMPLATE_HIGHLIGHT 2
+
+// tetromino_masks.sv; bit 4*row + col is set if the block at (row, col) of the 4x4 box is part of the shape
+const unsigned short int piece_masks[7][4] = {
+    {0x00F0, 0x4444, 0x0F00, 0x2222},
+    {0x0470, 0x0322, 0x0071, 0x0226},
+    {0x0170, 0x0223, 0x0074, 0x0622},
+    {0x0033, 0x0033, 0x0033, 0x0033},
+    {0x0360, 0x0231, 0x0036, 0x0462},
+    {0x0270, 0x0232, 0x0072, 0x0262},
+    {0x0630, 0x0132, 0x0063, 0x0264}
+};
+
+// tile id and next shape colors; 0 = empty, 1-7 = I-Z, 8 = gray
+const unsigned short int tile_colors[9] = {WHITE, 0x0FF, 0x00F, 0xF72, 0xFF0, 0x0F4, 0x90F, 0xF00, 0x555};
+
+void take_interrupt();
+void press_keys();
+void uart_update();
+bool uart_irq_pending();
+bool keyboard_irq_pending();
+bool vga_irq_pending();
+
+
+/**
+ * @brief charges core clocks, presses the keys that are due and ends every frame the clock moves past
+ *
+ * @param clocks
+ */
+void advance(unsigned long long clocks) {
+    mmio_counters.cycles += clocks;
+    press_keys();
+    uart_update();
+
+    while (mmio_counters.cycles >= (frame + 1) * (unsigned long long) TICKS_PER_FRAME) {
+        frame++;
+        if (mmio_frame_done != NULL) {
+            mmio_frame_done(frame - 1);
+        }
+        // the frame was scanned out of one page; a flip takes effect in the vertical blank after it
+        scanned_page = (page_register >> 4) & 1;
+        frame_count = (frame_count + 1) & 0xFFFFFF;
+        vblank_pending = true;
+        if (shift_waiting) {
+            move_tiles();
+            shift_waiting = false;
+        }
+    }
+}
+
+/**
+ * @brief writes game_ram at the cpu position; the RTL writes the current color there every clock
+ */
+void ram_write() {
+    if (cpu_row < SCREEN_HEIGHT && cpu_col < SCREEN_WIDTH) {
+        game_ram[page_register & 1][cpu_row * SCREEN_WIDTH + cpu_col] = cpu_color_index;
+    }
+}
+
+/**
+ * @brief template pixel of an 8x8 block
+ *
+ * @return TEMPLATE_OUTLINE, TEMPLATE_HIGHLIGHT or 0 for the block color
+ */
+unsigned int template_pixel(unsigned int row, unsigned int col) {
+    return (block_template[row & 7] >> ((7 - (col & 7)) * 2)) & 3;
+}
+
+/**
+ * @brief color of a tile pixel the way play_area_tiles.sv expands it
+ */
+unsigned int tile_pixel(unsigned int tile, unsigned int row, unsigned int col) {
+    unsigned int color = (tile <= GRAY_TILE) ? tile_colors[tile] : WHITE;
+
+    if (tile == 0 || tile >= GRAY_TILE) {
+        return color;
+    }
+
+    switch (template_pixel(row, col)) {
+        case TEMPLATE_OUTLINE:
+            return BLACK;
+        case TEMPLATE_HIGHLIGHT:
+            return WHITE;
+    }
+    return color;
+}
+
+/**
+ * @brief moves the tile map down over the cleared band in shift_register
+ */
+void move_tiles() {
+    unsigned int bottom_row = (shift_register >> 24) & 0x1F;
+    unsigned int offset = (shift_register & 7) * PLAY_AREA_BLOCKS_WIDE;
+    int last = bottom_row * PLAY_AREA_BLOCKS_WIDE + PLAY_AREA_BLOCKS_WIDE - 1;
+
+    for (int i = last; i >= 0; i--) {
+        tiles[i] = ((unsigned int) i >= offset) ? tiles[i - offset] : 0;
+    }
+}
+
+/**
+ * @brief starts a shift like the RTL row shift engine: at once in the vertical blank, otherwise at the next one
+ */
+void shift_tiles() {
+    unsigned int bottom_row = (shift_register >> 24) & 0x1F;
+    unsigned long long blank_start = frame * (unsigned long long) TICKS_PER_FRAME;
+    unsigned long long start = mmio_counters.cycles;
+
+    if (bottom_row >= PLAY_AREA_BLOCKS_TALL) {
+        return;
+    }
+
+    if (start < blank_start + VBLANK_TICKS) {
+        move_tiles();
+    }
+    else {
+        start = blank_start + TICKS_PER_FRAME;
+        shift_waiting = true;
+    }
+    shift_done = start + (bottom_row + 1) * PLAY_AREA_BLOCKS_WIDE; // one tile per clock
+}
+
+/**
+ * @brief vga_top register write
+ */
+void vga_write(unsigned int reg, unsigned int value) {
+    // held off while the tile map is shifting
+    if (shift_done > mmio_counters.cycles) {
+        unsigned long long busy = shift_done - mmio_counters.cycles;
+        mmio_counters.stall_cycles += busy;
+        advance(busy);
+    }
+
+    switch (reg) {
+        case VGA_RAM:
+            position_register = value;
+            cpu_row = (value >> 10) & 0x3FF;
+            cpu_col = value & 0x3FF;
+            stream_register &= ~0x80000000; // positioning a single pixel ends a stream
+            ram_write();
+            break;
+        case VGA_RGB:
+            rgb_register = value;
+            cpu_color_index = value & (PALETTE_SIZE - 1);
+            if (stream_register & 0x80000000) {
+                unsigned int start_col = stream_register & 0x3FF;
+                unsigned int width = (stream_register >> 20) & 0xFF;
+
+                if (stream_first) {
+                    cpu_row = (stream_register >> 10) & 0x3FF;
+                    cpu_col = start_col;
+                    stream_first = false;
+                }
+                else if (((cpu_col + 1) & 0x3FF) == ((start_col + width) & 0x3FF)) {
+                    cpu_row = (cpu_row + 1) & 0x3FF;
+                    cpu_col = start_col;
+                }
+                else {
+                    cpu_col = (cpu_col + 1) & 0x3FF;
+                }
+            }
+            ram_write();
+            break;
+        case VGA_NEXT_SHAPE:
+            next_shape_register = value;
+            break;
+        case VGA_SCORE:
+            score_register = value;
+            break;
+        case VGA_LEVEL:
+            level_register = value;
+            break;
+        case VGA_LINES:
+            lines_register = value;
+            break;
+        case VGA_PIECE:
+            piece_register = value;
+            break;
+        case VGA_TILE:
+            tile_register = value;
+            if (((value >> 24) & 0x1F) < PLAY_AREA_BLOCKS_TALL && ((value >> 16) & 0xF) < PLAY_AREA_BLOCKS_WIDE) {
+                tiles[((value >> 24) & 0x1F) * PLAY_AREA_BLOCKS_WIDE + ((value >> 16) & 0xF)] = value & 0xF;
+            }
+            break;
+        case VGA_STREAM:
+            stream_register = value;
+            stream_first = true;
+            break;
+        case VGA_ROW_SHIFT:
+            shift_register = value;
+            shift_tiles();
+            break;
+        case VGA_PALETTE:
+            palette_register = value;
+            palette[page_register & 1][(value >> 24) & (PALETTE_SIZE - 1)] = value & 0xFFF;
+            break;
+        case VGA_FLASH_ROWS:
+            flash_register = value;
+            break;
+        case VGA_PAGE:
+            page_register = value;
+            break;
+        case VGA_FRAME:
+            frame_register = value;
+            if (value & 0x80000000) {
+                vblank_pending = false;
+            }
+            break;
+    }
+}
+
+/**
+ * @brief vga_top register read (wb_dat_o)
+ */
+unsigned int vga_read(unsigned int reg) {
+    switch (reg) {
+        case VGA_RAM:
+            return position_register;
+        case VGA_RGB:
+            return rgb_register;
+        case VGA_NEXT_SHAPE:
+            return next_shape_register;
+        case VGA_SCORE:
+            return score_register;
+        case VGA_LEVEL:
+            return level_register;
+        case VGA_PIECE:
+            return piece_register;
+        case VGA_TILE:
+            return tile_register;
+        case VGA_STREAM:
+            return stream_register;
+        case VGA_ROW_SHIFT:
+            return ((shift_done > mmio_counters.cycles) << 31) | (shift_register & 0x7FFFFFFF);
+        case VGA_PALETTE:
+            return palette_register;
+        case VGA_FLASH_ROWS:
+            return flash_register;
+        case VGA_PAGE:
+            // bit 31 = flip pending, bit 8 = page on screen
+            return ((scanned_page != ((page_register >> 4) & 1)) << 31) | (scanned_page << 8) | (page_register & 0xFF);
+        case VGA_FRAME:
+            // bit 31 = vertical blank pending, bit 24 = interrupt on; the model is never inside the vertical blank
+            return (vblank_pending << 31) | ((frame_register & 1) << 24) | frame_count;
+    }
+    return lines_register;
+}
+
+/**
+ * @brief sets the THRE interrupt when the transmit FIFO goes empty with it on, or it is turned on with the FIFO
+ * empty, like thre_int_rise in uart_regs.v
+ */
+void uart_update() {
+    bool thre_int = (uart_ier & UART_IER_THRE) && mmio_counters.cycles >= uart_empty_time;
+
+    if (thre_int && !uart_thre_int) {
+        uart_thre_pending = true;
+    }
+    uart_thre_int = thre_int;
+}
+
+/**
+ * @brief uart16550 register write. A character leaves the transmit FIFO when the transmitter starts it, one every
+ * UART_CHAR_CYCLES; one written to an idle transmitter holds THRE off for a character time like uart_regs.v does.
+ * The model does not lose characters written to a full FIFO
+ */
+void uart_write(unsigned int reg, unsigned int value) {
+    bool dlab = uart_lcr & UART_LCR_DLAB;
+    unsigned long long start = 0;
+
+    switch (reg) {
+        case UART_THR:
+            if (dlab) {
+                break;
+            }
+            start = (uart_next_start > mmio_counters.cycles) ? uart_next_start : mmio_counters.cycles;
+            uart_next_start = start + UART_CHAR_CYCLES;
+            uart_empty_time = (start == mmio_counters.cycles) ? uart_next_start : start;
+            uart_thre_pending = false;
+            if (uart_file != NULL) {
+                fputc(value & 0xFF, uart_file);
+            }
+            break;
+        case UART_IER:
+            if (!dlab) {
+                uart_ier = value & 0xF;
+            }
+            break;
+        case UART_LCR:
+            uart_lcr = value & 0xFF;
+            break;
+    }
+
+    // turning the interrupt off clears it
+    if (!(uart_ier & UART_IER_THRE)) {
+        uart_thre_pending = false;
+    }
+    uart_update();
+}
+
+/**
+ * @brief uart16550 register read; reading IIR with THRE the pending interrupt clears it
+ */
+unsigned int uart_read(unsigned int reg) {
+    bool fifo_empty = mmio_counters.cycles >= uart_empty_time;
+    bool transmitter_empty = mmio_counters.cycles >= uart_next_start;
+
+    switch (reg) {
+        case UART_IER:
+            return (uart_lcr & UART_LCR_DLAB) ? 0 : uart_ier;
+        case UART_IIR:
+            // bits 7:6 = FIFOs on; bit 0 = 0 = an interrupt is pending, bits 3:1 = 001 = THRE
+            if (uart_thre_pending) {
+                uart_thre_pending = false;
+                return 0xC2;
+            }
+            return 0xC1;
+        case UART_LCR:
+            return uart_lcr;
+        case UART_LSR:
+            return (transmitter_empty << 6) | (fifo_empty << 5);
+    }
+    return 0;
+}
+
+/**
+ * @brief pops the oldest key event (KEY_EVENT_REG)
+ */
+unsigned int pop_key_fifo() {
+    unsigned int key_event = 0;
+
+    if (key_fifo_head != key_fifo_tail) {
+        key_event = 0x800 | key_fifo[key_fifo_tail % KEY_FIFO_SIZE];
+        key_fifo_tail++;
+    }
+    if (key_fifo_overflow) {
+        key_event |= 0x1000;
+        key_fifo_overflow = false;
+    }
+    return key_event;
+}
+
+unsigned int mmio_read(unsigned long address) {
+    unsigned int value = 0;
+
+    advance(BUS_ACCESS_CYCLES);
+
+    if (address == MTIME_REG) {
+        mmio_counters.mtime_reads++;
+        value = (unsigned int) mmio_counters.cycles;
+    }
+    else {
+        mmio_counters.reads++;
+        if (address >= VGA_BASE && address < VGA_BASE + VGA_SIZE) {
+            if (trace_file != NULL) {
+                fprintf(trace_file, "%llu r %lu\n", mmio_counters.cycles, (address >> 2) & 0xF);
+            }
+            value = vga_read((address >> 2) & 0xF);
+        }
+        else if (address >= UART_BASE && address < UART_BASE + UART_SIZE) {
+            value = uart_read((address >> 2) & 7);
+        }
+        else if (address == MTIMEH_REG) {
+            value = (unsigned int) (mmio_counters.cycles >> 32);
+        }
+        else if (address == KEY_STATE_REG) {
+            value = keys_held;
+        }
+        else if (address == KEY_EVENT_REG) {
+            value = pop_key_fifo();
+        }
+    }
+
+    take_interrupt();
+    return value;
+}
+
+void mmio_write(unsigned long address, unsigned int value) {
+    advance(BUS_ACCESS_CYCLES);
+    mmio_counters.writes++;
+
+    if (address >= VGA_BASE && address < VGA_BASE + VGA_SIZE) {
+        if (trace_file != NULL) {
+            fprintf(trace_file, "%llu w %lu %08x\n", mmio_counters.cycles, (address >> 2) & 0xF, value);
+        }
+        vga_write((address >> 2) & 0xF, value);
+    }
+    else if (address >= UART_BASE && address < UART_BASE + UART_SIZE) {
+        uart_write((address >> 2) & 7, value);
+    }
+    else if (address == PIC_MEIE(UART_IRQ_ID)) {
+        uart_irq_enabled = value & 1;
+    }
+    else if (address == PIC_MEIE(PS2_IRQ_ID)) {
+        keyboard_irq_enabled = value & 1;
+    }
+    else if (address == PIC_MEIE(VGA_IRQ_ID)) {
+        vga_irq_enabled = value & 1;
+    }
+
+    take_interrupt();
+}
+
+unsigned int mmio_read_csr(unsigned int csr) {
+    switch (csr) {
+        case MSTATUS:
+            return mstatus;
+        case MIE:
+            return mie;
+        case MCAUSE:
+            // the model only traps on interrupts, all of them external
+            return MCAUSE_EXTERNAL_INTERRUPT;
+        case MEIHAP:
+            // equal priorities; the lower id wins
+            if (uart_irq_pending()) {
+                return UART_IRQ_ID << 2;
+            }
+            if (keyboard_irq_pending()) {
+                return PS2_IRQ_ID << 2;
+            }
+            return vga_irq_pending() ? (VGA_IRQ_ID << 2) : 0;
+    }
+    return 0;
+}
+
+void mmio_write_csr(unsigned int csr, unsigned int value) {
+    switch (csr) {
+        case MSTATUS:
+            mstatus = value;
+            break;
+        case MIE:
+            mie = value;
+            break;
+    }
+
+    // turning interrupts back on takes the ones that are pending
+    take_interrupt();
+}
+
+bool uart_irq_pending() {
+    return uart_irq_enabled && uart_thre_pending;
+}
+
+bool keyboard_irq_pending() {
+    return keyboard_irq_enabled && key_fifo_head != key_fifo_tail;
+}
+
+bool vga_irq_pending() {
+    return vga_irq_enabled && (frame_register & 1) && vblank_pending;
+}
+
+/**
+ * @brief wfi: skips to the next frame end, key script event or transmit FIFO empty until an enabled interrupt is
+ * pending. Like the core, it wakes up whether or not mstatus lets the interrupt be taken
+ */
+void mmio_wait_for_interrupt() {
+    while (!uart_irq_pending() && !keyboard_irq_pending() && !vga_irq_pending()) {
+        unsigned long long wake = (frame + 1) * (unsigned long long) TICKS_PER_FRAME;
+        bool uart_wakes = uart_irq_enabled && (uart_ier & UART_IER_THRE) && !uart_thre_int;
+
+        if (!(vga_irq_enabled && (frame_register & 1)) && key_script_next == key_script_length && !uart_wakes) {
+            fprintf(stderr, "wfi at cycle %llu with no interrupt that can wake it\n", mmio_counters.cycles);
+            exit(1);
+        }
+        if (key_script_next < key_script_length && key_script[key_script_next].time < wake) {
+            wake = key_script[key_script_next].time;
+        }
+        if (uart_wakes && uart_empty_time < wake) {
+            wake = uart_empty_time;
+        }
+        advance((wake > mmio_counters.cycles) ? wake - mmio_counters.cycles : 1);
+    }
+    take_interrupt();
+}
+
+/**
+ * @brief runs trap_handler() between bus accesses while an interrupt is pending and enabled
+ */
+void take_interrupt() {
+    if (in_trap || (!uart_irq_pending() && !keyboard_irq_pending() && !vga_irq_pending())) {
+        return;
+    }
+    if (!(mstatus & MSTATUS_MIE) || !(mie & MIE_MEIE)) {
+        return;
+    }
+
+    in_trap = true;
+    trap_handler();
+    in_trap = false;
+}
+
+/**
+ * @brief feeds the key events that are due into the keyboard model
+ */
+void press_keys() {
+    while (key_script_next < key_script_length && key_script[key_script_next].time <= mmio_counters.cycles) {
+        key_script_event_t *event = &key_script[key_script_next++];
+
+        if (key_fifo_head - key_fifo_tail < KEY_FIFO_SIZE) {
+            key_fifo[key_fifo_head % KEY_FIFO_SIZE] = event->key_event;
+            key_fifo_head++;
+        }
+        else {
+            key_fifo_overflow = true;
+        }
+
+        if (event->key_event & KEY_BREAK) {
+            keys_held &= ~event->key_state;
+        }
+        else {
+            keys_held |= event->key_state;
+        }
+    }
+}
+
+/**
+ * @brief color of one game pixel as vga_top sends it to the monitor
+ */
+unsigned int mmio_screen_pixel(unsigned int row, unsigned int col) {
+    bool sections_on = position_register & 0x80000000;
+    bool tile_map_on = tile_register & 0x80000000;
+    unsigned int play_row = row - PLAY_AREA_ROW;
+    unsigned int play_col = col - PLAY_AREA_COL;
+    const unsigned int digit_rows[3] = {SCORE_ROW, LEVEL_ROW, LINES_ROW};
+    const unsigned int digit_registers[3] = {score_register, level_register, lines_register};
+
+    if (sections_on) {
+        for (int i = 0; i < 3; i++) {
+            if (row >= digit_rows[i] && row < digit_rows[i] + BLOCK_PIXELS &&
+                col >= DIGITS_COL && col < DIGITS_COL + NUM_OF_DIGITS * BLOCK_PIXELS) {
+                unsigned int digit_index = NUM_OF_DIGITS - 1 - (col - DIGITS_COL) / BLOCK_PIXELS;
+                unsigned int digit = (digit_registers[i] >> (4 * digit_index)) & 0xF;
+                unsigned int glyph_row = digit_glyphs[digit][(row - digit_rows[i]) % BLOCK_PIXELS];
+
+                return (glyph_row & (0x80 >> ((col - DIGITS_COL) % BLOCK_PIXELS))) ? BLACK : WHITE;
+            }
+        }
+
+        if (row >= NEXT_SHAPE_ROW && row < NEXT_SHAPE_ROW + NEXT_SHAPE_SIZE &&
+            col >= NEXT_SHAPE_COL && col < NEXT_SHAPE_COL + NEXT_SHAPE_SIZE) {
+            unsigned int shape = next_shape_register & 7;
+            unsigned int sprite_row = shape_sprites[shape][(row - NEXT_SHAPE_ROW) / SPRITE_PIXEL];
+
+            if (sprite_row & (0x80 >> ((col - NEXT_SHAPE_COL) / SPRITE_PIXEL))) {
+                return (shape < 7) ? tile_colors[shape + 1] : BLACK;
+            }
+            return WHITE;
+        }
+    }
+
+    if (tile_map_on && play_row < PLAY_AREA_BLOCKS_TALL * BLOCK_PIXELS && play_col < PLAY_AREA_BLOCKS_WIDE * BLOCK_PIXELS) {
+        unsigned int tile = tiles[(play_row / BLOCK_PIXELS) * PLAY_AREA_BLOCKS_WIDE + play_col / BLOCK_PIXELS];
+        // block inside the 4x4 box of the falling shape; the box position is two's complement like in the RTL
+        unsigned int box_row = (play_row / BLOCK_PIXELS - (piece_register >> 24)) & 0x3F;
+        unsigned int box_col = (play_col / BLOCK_PIXELS - (((piece_register >> 16) & 0x1F) | ((piece_register >> 15) & 0x20))) & 0x3F;
+        unsigned int ghost_box_row = (play_row / BLOCK_PIXELS - (piece_register >> 10)) & 0x3F;
+        unsigned int shape = piece_register & 7;
+        unsigned int mask = (shape < 7) ? piece_masks[shape][(piece_register >> 8) & 3] : 0;
+        bool ghost = false;
+
+        if ((piece_register & 0x80000000) && box_row < 4 && box_col < 4 && (mask & (1 << (4 * box_row + box_col)))) {
+            tile = shape + 1;
+        }
+        else if ((piece_register & 0x40000000) && tile == 0 && ghost_box_row < 4 && box_col < 4 &&
+                 (mask & (1 << (4 * ghost_box_row + box_col)))) {
+            ghost = true;
+            tile = shape + 1;
+        }
+
+        if (flash_register & (1 << (play_row / BLOCK_PIXELS))) {
+            return GRAY;
+        }
+        // the ghost is only the outline of a block, in the color of the shape
+        if (ghost) {
+            return (template_pixel(play_row, play_col) == TEMPLATE_OUTLINE) ? tile_colors[tile] : WHITE;
+        }
+        return tile_pixel(tile, play_row, play_col);
+    }
+
+    return palette[scanned_page][game_ram[scanned_page][row * SCREEN_WIDTH + col]];
+}
+
+/**
+ * @brief writes the screen as a binary PPM; 160x144, 12-bit color stretched to 8 bits per channel
+ *
+ * @return 0, or -1 if the file could not be written
+ */
+int mmio_save_frame(const char *path) {
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL) {
+        return -1;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (unsigned int row = 0; row < SCREEN_HEIGHT; row++) {
+        for (unsigned int col = 0; col < SCREEN_WIDTH; col++) {
+            unsigned int color = mmio_screen_pixel(row, col);
+            unsigned char rgb[3] = {((color >> 8) & 0xF) * 17, ((color >> 4) & 0xF) * 17, (color & 0xF) * 17};
+            fwrite(rgb, 1, 3, file);
+        }
+    }
+    return fclose(file);
+}
+
+/**
+ * @brief queues a key press or release; events must be queued in time order
+ *
+ * @param time       model time of the event
+ * @param key_event  scancode, | KEY_BREAK for a release
+ * @param key_state  KEY_STATE_* bit of the key
+ * @return 0, or -1 if the queue is full
+ */
+int mmio_queue_key(unsigned long long time, unsigned short int key_event, unsigned int key_state) {
+    if (key_script_length == MAX_SCRIPT_EVENTS) {
+        return -1;
+    }
+
+    key_script[key_script_length].time = time;
+    key_script[key_script_length].key_event = key_event;
+    key_script[key_script_length].key_state = key_state;
+    key_script_length++;
+    return 0;
+}
+
+/**
+ * @brief queues the key events of a key script; see the top of this file
+ *
+ * @return 0, or -1 if the file could not be read
+ */
+int mmio_load_key_script(const char *path) {
+    const struct { const char *name; unsigned short int key; unsigned int state; } keys[] = {
+        {"w", W_KEY, KEY_STATE_W},
+        {"a", A_KEY, KEY_STATE_A},
+        {"s", S_KEY, KEY_STATE_S},
+        {"d", D_KEY, KEY_STATE_D},
+        {"enter", ENTER_KEY, KEY_STATE_ENTER},
+        {"space", SPACE_KEY, KEY_STATE_SPACE}
+    };
+    char line[256], name[32], action[32];
+    unsigned long event_frame = 0;
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL) {
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char *comment = strchr(line, '#');
+        int found = -1;
+
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+        if (sscanf(line, "%lu %31s %31s", &event_frame, name, action) != 3) {
+            continue;
+        }
+
+        for (unsigned int i = 0; i < sizeof(keys) / sizeof(keys[0]); i++) {
+            if (strcmp(name, keys[i].name) == 0) {
+                found = i;
+            }
+        }
+        if (found < 0) {
+            fprintf(stderr, "%s: skipping \"%s %s\"\n", path, name, action);
+            continue;
+        }
+
+        mmio_queue_key(event_frame * TICKS_PER_FRAME, keys[found].key | ((strcmp(action, "release") == 0) ? KEY_BREAK : 0),
+                       keys[found].state);
+    }
+    return fclose(file);
+}
+
+/**
+ * @brief starts recording every vga_top access to a trace file; see the top of this file
+ *
+ * @return 0, or -1 if the file could not be opened
+ */
+int mmio_trace_open(const char *path) {
+    trace_file = fopen(path, "w");
+    return (trace_file == NULL) ? -1 : 0;
+}
+
+/**
+ * @brief flushes and closes the trace file
+ */
+void mmio_trace_close() {
+    if (trace_file != NULL) {
+        fclose(trace_file);
+        trace_file = NULL;
+    }
+}
+
+/**
+ * @brief opens the file everything main.c sends out of the UART goes to
+ *
+ * @return 0, or -1 if the file could not be opened
+ */
+int mmio_uart_open(const char *path) {
+    uart_file = fopen(path, "w");
+    return (uart_file == NULL) ? -1 : 0;
+}
+
+/**
+ * @brief flushes and closes the UART file
+ */
+void mmio_uart_close() {
+    if (uart_file != NULL) {
+        fclose(uart_file);
+        uart_file = NULL;
+    }
+}
+
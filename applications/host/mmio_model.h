@@ -0,0 +1,51 @@
+/**
+* Brief:
+* register access for the Linux build of main.c (tetris_emulator). main.c includes this instead of its
+* READ_GPIO/WRITE_GPIO/CSR macros when HOST_EMULATOR is defined, so every load and store to a peripheral
+* goes through mmio_model.c: a model of the vga_top register file, game_ram, the play area tile map, the
+* score/level/lines digits, the next shape sprite and the vertical blank, plus the keyboard, mtime, the PIC and
+* the UART.
+* main() of main.c becomes firmware_main(); the host tool linking it has the real main()
+**/
+#ifndef __MMIO_MODEL__
+#define __MMIO_MODEL__
+
+// bus traffic since the model started; take differences to measure a piece of code
+typedef struct mmio_counters {
+    unsigned long writes;
+    unsigned long reads;              // not counting mtime, which the game loop reads to time its frames and key repeats
+    unsigned long mtime_reads;
+    unsigned long stall_cycles;       // writes held off by the row shift engine
+    unsigned long long cycles;        // model time in core clocks
+} mmio_counters_t;
+
+extern mmio_counters_t mmio_counters;
+extern void (*mmio_frame_done)(unsigned long frame); // called at the end of every 1/60 s of model time
+
+unsigned int mmio_read(unsigned long address);
+void mmio_write(unsigned long address, unsigned int value);
+unsigned int mmio_read_csr(unsigned int csr);
+void mmio_write_csr(unsigned int csr, unsigned int value);
+void mmio_wait_for_interrupt();
+int mmio_queue_key(unsigned long long time, unsigned short int key_event, unsigned int key_state);
+int mmio_load_key_script(const char *path);
+unsigned int mmio_screen_pixel(unsigned int row, unsigned int col);
+int mmio_save_frame(const char *path);
+int mmio_trace_open(const char *path);
+void mmio_trace_close();
+int mmio_uart_open(const char *path);
+void mmio_uart_close();
+
+#define READ_GPIO(dir) (mmio_read((unsigned long)(dir)))
+#define WRITE_GPIO(dir, value) { mmio_write((unsigned long)(dir), (value)); }
+#define READ_CSR(csr, value) ((value) = mmio_read_csr(csr))
+#define WRITE_CSR(csr, value) mmio_write_csr((csr), (unsigned int)(unsigned long)(value))
+#define SET_CSR(csr, mask) mmio_write_csr((csr), mmio_read_csr(csr) | (mask))
+#define CLEAR_CSR(csr, mask) mmio_write_csr((csr), mmio_read_csr(csr) & ~(mask))
+#define WAIT_FOR_INTERRUPT() mmio_wait_for_interrupt()
+#define INTERRUPT_HANDLER
+
+#define main firmware_main
+int firmware_main(void);
+
+#endif
@@ -0,0 +1,105 @@
+/**
+* Brief:
+* runs main.c against mmio_model.c. The bus traffic of every frame is printed as one CSV line and the
+* screen can be saved as a PPM image.
+*
+* usage: tetris_emulator [-n frames] [-k key_script] [-p ppm_dir] [-e every_nth_frame] [-t trace] [-u uart_log]
+* key script and trace: see mmio_model.c; the UART log gets the record of every game played (see tetris_replay)
+**/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "mmio_model.h"
+
+#undef main // only main.c is renamed to firmware_main
+
+#define TICKS_PER_FRAME (50000000 / 60)
+
+unsigned long max_frames = 600;
+unsigned long capture_every = 1;
+const char *ppm_dir = NULL;
+mmio_counters_t frame_start;
+
+/** main.c **/
+extern unsigned int dropped_frames, busiest_frame_ticks;
+
+/**
+ * @brief prints the bus traffic of the frame that just ended, saves its screen and stops after max_frames
+ *
+ * @param frame
+ */
+void end_frame(unsigned long frame) {
+    printf("%lu,%lu,%lu,%lu,%lu\n", frame,
+           mmio_counters.writes - frame_start.writes, mmio_counters.reads - frame_start.reads,
+           mmio_counters.mtime_reads - frame_start.mtime_reads, mmio_counters.stall_cycles - frame_start.stall_cycles);
+    frame_start = mmio_counters;
+
+    if (ppm_dir != NULL && frame % capture_every == 0) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/frame_%05lu.ppm", ppm_dir, frame);
+        if (mmio_save_frame(path) != 0) {
+            perror(path);
+            exit(1);
+        }
+    }
+
+    if (frame + 1 >= max_frames) {
+        fprintf(stderr, "%lu frames: %lu writes (%.1f/frame), %lu reads, %lu stall cycles\n",
+                frame + 1, mmio_counters.writes, (double) mmio_counters.writes / (frame + 1),
+                mmio_counters.reads, mmio_counters.stall_cycles);
+        fprintf(stderr, "game loop: %u dropped frames, busiest frame %u ticks (%.1f%% of a frame)\n",
+                dropped_frames, busiest_frame_ticks, 100.0 * busiest_frame_ticks / TICKS_PER_FRAME);
+        mmio_trace_close();
+        mmio_uart_close();
+        exit(0);
+    }
+}
+
+int main(int argc, char **argv) {
+    int option = 0;
+
+    while ((option = getopt(argc, argv, "n:k:p:e:t:u:")) != -1) {
+        switch (option) {
+            case 'n':
+                max_frames = strtoul(optarg, NULL, 10);
+                break;
+            case 'k':
+                if (mmio_load_key_script(optarg) != 0) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+            case 'p':
+                ppm_dir = optarg;
+                break;
+            case 'e':
+                capture_every = strtoul(optarg, NULL, 10);
+                if (capture_every == 0) {
+                    capture_every = 1;
+                }
+                break;
+            case 't':
+                if (mmio_trace_open(optarg) != 0) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+            case 'u':
+                if (mmio_uart_open(optarg) != 0) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n frames] [-k key_script] [-p ppm_dir] [-e every_nth_frame] [-t trace] [-u uart_log]\n",
+                        argv[0]);
+                return 1;
+        }
+    }
+
+    printf("frame,writes,reads,mtime_reads,stall_cycles\n");
+    mmio_frame_done = end_frame;
+    firmware_main();
+    return 0;
+}
@@ -0,0 +1,246 @@
+/**
+* Brief:
+* replays the game records main.c sends out of the UART (see replay.h and send_record in main.c) through the game
+* core as fast as it can. Every step that locks a shape is checked against the board hash in the record and the end
+* of the game against its score and board; a record that goes another way is reported with the frame it left at.
+* With -c the record is also written as the replay_bench.h of the no-input benchmark build of main.c (REPLAY_BENCH).
+*
+* usage: tetris_replay [-n runs] [-r record] [-c header] uart_log
+* runs: times each record is replayed for the timing; record: only replay the record-th one (1 = first)
+* exits with 1 if a record does not replay, or the log holds none
+**/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "game_core.h"
+#include "replay.h"
+
+#define MAX_LINE 256
+
+typedef struct uart_record {
+    unsigned int seed;
+    unsigned char bytes[REPLAY_BUFFER_SIZE];
+    unsigned int length;
+    bool ended;                 // the END line was read
+    unsigned int locks;
+    unsigned int score;
+    unsigned int hash;
+    bool truncated;
+} uart_record_t;
+
+typedef struct replay_result {
+    bool matched;
+    unsigned int frames;        // game loop frames replayed
+    unsigned int steps;
+    unsigned int locks;
+    unsigned int score;
+    unsigned int hash;          // replay_board_hash at the end
+} replay_result_t;
+
+/**
+ * @brief reads the next record out of a UART log; any other text in the log is skipped
+ *
+ * @param file
+ * @param record
+ * @return false if there are no more records
+ */
+bool read_record(FILE *file, uart_record_t *record) {
+    char line[MAX_LINE];
+    bool in_record = false;
+
+    memset(record, 0, sizeof(*record));
+    while (fgets(line, sizeof(line), file) != NULL) {
+        unsigned int truncated = 0;
+        // the UART driver sends a carriage return after every new line, so it starts the next line
+        char *hex = line + strspn(line, " \t\r");
+
+        if (sscanf(hex, "REPLAY seed=%x", &record->seed) == 1) {
+            in_record = true;
+            record->length = 0;
+            continue;
+        }
+        if (!in_record) {
+            continue;
+        }
+        if (sscanf(hex, "END length=%*x locks=%x score=%x hash=%x truncated=%x",
+                   &record->locks, &record->score, &record->hash, &truncated) == 4) {
+            record->ended = true;
+            record->truncated = truncated;
+            return true;
+        }
+
+        // a line of record bytes
+        while (hex[0] != '\0' && hex[1] != '\0' && hex[0] != '\r' && hex[0] != '\n') {
+            unsigned int byte = 0;
+
+            if (sscanf(hex, "%2x", &byte) != 1 || record->length == REPLAY_BUFFER_SIZE) {
+                break;
+            }
+            record->bytes[record->length++] = byte;
+            hex += 2;
+        }
+    }
+
+    // a log cut off in the middle of a record still replays up to where it ends
+    return in_record;
+}
+
+/**
+ * @brief plays a record through game_core the way the game loop of main.c ran it; see replay.h
+ *
+ * @param record
+ * @param result
+ */
+void replay_record(const uart_record_t *record, replay_result_t *result) {
+    game_state_t game;
+    replay_reader_t reader;
+    unsigned int events = 0;
+    unsigned int input = 0;
+    bool shape_locked = false;
+
+    memset(result, 0, sizeof(*result));
+    result->matched = true;
+    game_init(&game, record->seed);
+    replay_reader_init(&reader, record->bytes, record->length);
+
+    while (!game.game_over && !reader.done && result->matched) {
+        shape_locked = false;
+
+        while (result->matched && !shape_locked && replay_key_step(&reader, result->frames, &input)) {
+            events = game_step(&game, input);
+            result->matched = replay_check_step(&reader, &game, events);
+            shape_locked = (events & GAME_EVENT_LOCKED) != 0;
+            result->steps++;
+        }
+        if (result->matched && !shape_locked) {
+            events = game_step(&game, replay_frame_step(&reader, result->frames));
+            result->matched = replay_check_step(&reader, &game, events);
+            shape_locked = (events & GAME_EVENT_LOCKED) != 0;
+            result->steps++;
+        }
+        result->locks += shape_locked;
+        result->frames++;
+    }
+
+    result->score = game.score;
+    result->hash = replay_board_hash(&game);
+    // a whole record has to end where the game ended
+    if (result->matched && record->ended && !record->truncated) {
+        result->matched = game.game_over && reader.done && result->locks == record->locks &&
+                          result->score == record->score && result->hash == record->hash;
+    }
+}
+
+/**
+ * @brief writes a record as replay_bench.h for the REPLAY_BENCH build of main.c
+ *
+ * @return 0, or -1 if the file could not be written
+ */
+int write_header(const char *path, const uart_record_t *record) {
+    FILE *file = fopen(path, "w");
+
+    if (file == NULL) {
+        return -1;
+    }
+
+    fprintf(file, "// game record for the no-input benchmark of main.c (REPLAY_BENCH); written by tetris_replay -c\n");
+    fprintf(file, "#ifndef __REPLAY_BENCH__\n#define __REPLAY_BENCH__\n\n");
+    fprintf(file, "const unsigned int replay_bench_seed = 0x%08X;\n", record->seed);
+    fprintf(file, "const unsigned int replay_bench_length = %u;\n", record->length);
+    fprintf(file, "const unsigned char replay_bench_bytes[%u] = {", record->length ? record->length : 1);
+    for (unsigned int i = 0; i < record->length; i++) {
+        fprintf(file, "%s0x%02X%s", (i % 16 == 0) ? "\n    " : "", record->bytes[i],
+                (i + 1 < record->length) ? ", " : "");
+    }
+    fprintf(file, "\n};\n\n#endif\n");
+
+    return fclose(file);
+}
+
+int main(int argc, char **argv) {
+    const char *header_path = NULL;
+    unsigned long runs = 1;
+    unsigned long only = 0;
+    unsigned long count = 0;
+    unsigned int failed = 0;
+    int option = 0;
+    FILE *log = NULL;
+    static uart_record_t record;
+    replay_result_t result;
+
+    while ((option = getopt(argc, argv, "n:r:c:")) != -1) {
+        switch (option) {
+            case 'n':
+                runs = strtoul(optarg, NULL, 10);
+                if (runs == 0) {
+                    runs = 1;
+                }
+                break;
+            case 'r':
+                only = strtoul(optarg, NULL, 10);
+                break;
+            case 'c':
+                header_path = optarg;
+                break;
+            default:
+                optind = argc + 1;
+                break;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s [-n runs] [-r record] [-c header] uart_log\n", argv[0]);
+        return 1;
+    }
+
+    log = fopen(argv[optind], "r");
+    if (log == NULL) {
+        perror(argv[optind]);
+        return 1;
+    }
+
+    printf("record,seed,bytes,frames,steps,locks,score,hash,status,us_per_replay\n");
+    while (read_record(log, &record)) {
+        struct timespec start, stop;
+        double seconds = 0;
+
+        count++;
+        if (only != 0 && count != only) {
+            continue;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (unsigned long run = 0; run < runs; run++) {
+            replay_record(&record, &result);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        seconds = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) / 1e9;
+
+        printf("%lu,%08X,%u,%u,%u,%u,%X,%08X,%s,%.1f\n", count, record.seed, record.length, result.frames,
+               result.steps, result.locks, result.score, result.hash,
+               !result.matched ? "diverged" : (record.truncated || !record.ended) ? "ok (truncated)" : "ok",
+               seconds * 1e6 / runs);
+        if (!result.matched) {
+            fprintf(stderr, "record %lu left the recorded game at frame %u (lock %u)\n", count, result.frames,
+                    result.locks);
+            failed++;
+        }
+
+        if (header_path != NULL) {
+            if (write_header(header_path, &record) != 0) {
+                perror(header_path);
+                return 1;
+            }
+            header_path = NULL; // the first record replayed
+        }
+    }
+    fclose(log);
+
+    if (count == 0) {
+        fprintf(stderr, "%s: no game records\n", argv[optind]);
+        return 1;
+    }
+    return (failed > 0) ? 1 : 0;
+}
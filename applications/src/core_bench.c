@@ -0,0 +1,307 @@
+/**
+* Brief:
+* cycle counts of game core routines against the code they replaced; see core_bench.h
+**/
+#include <math.h>
+#include "core_bench.h"
+#include "game_core.h"
+
+/** replaced code **/
+#define BLOCK_DIMENSION 8         // old shapes were kept in screen pixels, top left point of each 8x8 block
+#define PI_HALF 1.57079632679489661923
+#define PIXEL_OCCUPIED 1
+#define PIXEL_WILL_BE_FREED 99    // used in collision functions, space in game_board will be unoccupied after a rotate
+#define SCORE_UPDATES 64          // score updates timed at a time
+#define SCORE_RESTART 900000      // scores restart from 0 past this, so a round never reaches the 6 digit limit
+
+typedef struct old_shape {
+    tetris_shapes_t shape;
+    unsigned int blocks_x[BLOCKS_PER_SHAPE]; // top left point of each block in pixels
+    unsigned int blocks_y[BLOCKS_PER_SHAPE];
+    int pivot_x;                             // point the shape turns about, in pixels
+    int pivot_y;
+} old_shape_t;
+
+/** function declarations **/
+bool rotate_shape(game_state_t *game); // game_core.c; only game_step calls it in the game
+void old_spawn(old_shape_t *old, tetris_shapes_t shape);
+void old_rotate_shape(old_shape_t *old);
+bool old_collision_rotation(const old_shape_t *old, const unsigned int new_x[BLOCKS_PER_SHAPE], const unsigned int new_y[BLOCKS_PER_SHAPE]);
+unsigned int old_update_number(unsigned int number);
+
+/** hash tables **/
+// spawn blocks and pivot of each shape, as the old shape_vertices() set them
+const old_shape_t old_spawns[NUM_OF_TETRIS_SHAPES] = {
+    [i_shape] = {i_shape, {3*8, 4*8, 5*8, 6*8}, {1*8, 1*8, 1*8, 1*8}, 5*8, 1*8 + 8},
+    [j_shape] = {j_shape, {3*8, 4*8, 5*8, 5*8}, {1*8, 1*8, 1*8, 2*8}, 4*8 + 4, 1*8 + 4},
+    [l_shape] = {l_shape, {3*8, 4*8, 5*8, 3*8}, {1*8, 1*8, 1*8, 2*8}, 4*8 + 4, 1*8 + 4},
+    [o_shape] = {o_shape, {3*8, 4*8, 3*8, 4*8}, {0*8, 0*8, 1*8, 1*8}, 4*8, 0*8 + 8},
+    [s_shape] = {s_shape, {4*8, 5*8, 3*8, 4*8}, {1*8, 1*8, 2*8, 2*8}, 4*8 + 4, 1*8 + 4},
+    [t_shape] = {t_shape, {3*8, 4*8, 5*8, 4*8}, {1*8, 1*8, 1*8, 2*8}, 4*8 + 4, 1*8 + 4},
+    [z_shape] = {z_shape, {3*8, 4*8, 4*8, 5*8}, {1*8, 1*8, 2*8, 2*8}, 4*8 + 4, 1*8 + 4}
+};
+
+// points a score update adds: a soft drop row, then the line clears at level 0; binary for the old code, BCD for bcd_add
+const unsigned int bench_points[] = {1, 40, 100, 300, 1200};
+const unsigned int bench_points_bcd[] = {0x1, 0x40, 0x100, 0x300, 0x1200};
+#define NUM_OF_BENCH_POINTS (sizeof(bench_points) / sizeof(bench_points[0]))
+
+// the old virtual board; the falling shape was written into it
+unsigned char old_game_board[GAME_BOARD_Y_MAX][GAME_BOARD_X_MAX];
+
+/**
+ * @brief times rotate_shape against the old cos/sin rotation. Each round spawns every shape on an empty board
+ * and turns it all the way around, so both sides rotate the same 28 times; the cells each rotation lands on
+ * are compared after the timed part
+ *
+ * @param result
+ * @param read_counter
+ * @param rounds
+ */
+void bench_rotation(core_bench_result_t *result, bench_counter_t read_counter, unsigned int rounds) {
+    game_state_t game;
+    old_shape_t old;
+    vertex_t new_cells[NUM_OF_ORIENTATIONS][BLOCKS_PER_SHAPE];
+    vertex_t old_cells[NUM_OF_ORIENTATIONS][BLOCKS_PER_SHAPE];
+    unsigned int start = 0;
+
+    result->calls = 0;
+    result->new_ticks = 0;
+    result->old_ticks = 0;
+    result->matched = true;
+
+    for (unsigned int round = 0; round < rounds; round++) {
+        for (int shape = 0; shape < NUM_OF_TETRIS_SHAPES; shape++) {
+            tetris_shape_obj_t *current_shape = &game.current_shape;
+
+            // the same shape at its spawn point on both sides
+            game_init(&game, 1);
+            current_shape->shape = shape;
+            current_shape->orientation = 0;
+            current_shape->origin.x = SPAWN_ORIGIN_COL;
+            current_shape->origin.y = SPAWN_ORIGIN_ROW;
+            for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+                current_shape->blocks[i].x = SPAWN_ORIGIN_COL + shape_orientations[shape][0].blocks[i].x;
+                current_shape->blocks[i].y = SPAWN_ORIGIN_ROW + shape_orientations[shape][0].blocks[i].y;
+            }
+            old_spawn(&old, shape);
+
+            start = read_counter();
+            for (int turn = 0; turn < NUM_OF_ORIENTATIONS; turn++) {
+                rotate_shape(&game);
+                for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+                    new_cells[turn][i] = current_shape->blocks[i];
+                }
+            }
+            result->new_ticks += read_counter() - start;
+
+            start = read_counter();
+            for (int turn = 0; turn < NUM_OF_ORIENTATIONS; turn++) {
+                old_rotate_shape(&old);
+                for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+                    old_cells[turn][i].x = old.blocks_x[i] / BLOCK_DIMENSION;
+                    old_cells[turn][i].y = old.blocks_y[i] / BLOCK_DIMENSION;
+                }
+            }
+            result->old_ticks += read_counter() - start;
+
+            for (int turn = 0; turn < NUM_OF_ORIENTATIONS; turn++) {
+                for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+                    if ((new_cells[turn][i].x != old_cells[turn][i].x) || (new_cells[turn][i].y != old_cells[turn][i].y)) {
+                        result->matched = false;
+                    }
+                }
+            }
+            result->calls += NUM_OF_ORIENTATIONS;
+        }
+    }
+}
+
+/**
+ * @brief puts a shape at its old spawn point on an empty old board
+ *
+ * @param old
+ * @param shape
+ */
+void old_spawn(old_shape_t *old, tetris_shapes_t shape) {
+    *old = old_spawns[shape];
+
+    for (int row = 0; row < GAME_BOARD_Y_MAX; row++) {
+        for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
+            old_game_board[row][col] = 0;
+        }
+    }
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        old_game_board[old->blocks_y[i] / BLOCK_DIMENSION][old->blocks_x[i] / BLOCK_DIMENSION] = PIXEL_OCCUPIED;
+    }
+}
+
+/**
+ * @brief the old rotate_shape(): rotates all the points of the shape CLOCK-WISE by 90 degrees about its pivot.
+ * Only draw_block() and the color plane are left out
+ *
+ * @param old
+ */
+void old_rotate_shape(old_shape_t *old) {
+    if (old->shape == o_shape)
+        return;
+
+    // for storing new position
+    unsigned int new_x[BLOCKS_PER_SHAPE] = {0};
+    unsigned int new_y[BLOCKS_PER_SHAPE] = {0};
+    int x0, y0; // for centering the current x and y around the origin
+
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        // center points around origin; rotation only works if its centered around origin
+        x0 = old->blocks_x[i] - old->pivot_x;
+        y0 = old->blocks_y[i] - old->pivot_y;
+
+        // calculate new point and un-center it around origin
+        // new x is now at top right corner so need to subtract block width (move to top left)
+        new_x[i] = (int) round(((x0 * cos(PI_HALF) - y0 * sin(PI_HALF)) + old->pivot_x) - BLOCK_DIMENSION);
+        new_y[i] = (int) round((x0 * sin(PI_HALF) + y0 * cos(PI_HALF)) + old->pivot_y);
+    }
+
+    if (old_collision_rotation(old, new_x, new_y)) {
+        return;
+    }
+
+    // clear old posititon from the virtual screen
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        old_game_board[old->blocks_y[i] / BLOCK_DIMENSION][old->blocks_x[i] / BLOCK_DIMENSION] = 0;
+    }
+
+    // update shape with position and the virtual screen with the new position
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        old->blocks_x[i] = new_x[i];
+        old->blocks_y[i] = new_y[i];
+        old_game_board[new_y[i] / BLOCK_DIMENSION][new_x[i] / BLOCK_DIMENSION] = PIXEL_OCCUPIED;
+    }
+}
+
+/**
+ * @brief the old collision_rotation(): detects if a rotation will cause a collision
+ *
+ * @param old
+ * @param new_x  what the x coordinates will be if the rotation happens
+ * @param new_y  what the y coordinates will be if the rotation happens
+ */
+bool old_collision_rotation(const old_shape_t *old, const unsigned int new_x[BLOCKS_PER_SHAPE], const unsigned int new_y[BLOCKS_PER_SHAPE]) {
+    vertex_t coord_old[BLOCKS_PER_SHAPE];
+    vertex_t coord_new[BLOCKS_PER_SHAPE];
+    bool collision = false;
+
+    // converting screen coordinates into game_board[][] usable coordinates
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        coord_old[i].x = old->blocks_x[i] / BLOCK_DIMENSION;
+        coord_old[i].y = old->blocks_y[i] / BLOCK_DIMENSION;
+        coord_new[i].x = new_x[i] / BLOCK_DIMENSION;
+        coord_new[i].y = new_y[i] / BLOCK_DIMENSION;
+        // marking gameboard to keep track of current shape
+        old_game_board[coord_old[i].y][coord_old[i].x] = PIXEL_WILL_BE_FREED;
+    }
+
+    // checking if new pixel location is out of bounds or is in occupied space
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        if (
+            (coord_new[i].x > (GAME_BOARD_X_MAX - 1)) ||
+            (coord_new[i].x < GAME_BOARD_X_MIN)       ||
+            (coord_new[i].y > (GAME_BOARD_Y_MAX - 1)) ||
+            (coord_new[i].y < GAME_BOARD_Y_MIN)
+        ) {
+            collision = true;
+            break;
+        }
+        else if (old_game_board[coord_new[i].y][coord_new[i].x] == PIXEL_OCCUPIED) {
+            collision = true;
+            break;
+        }
+    }
+
+    // unmarking gameboard changes
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        old_game_board[coord_old[i].y][coord_old[i].x] = PIXEL_OCCUPIED;
+    }
+
+    return collision;
+}
+
+/**
+ * @brief times keeping the score in BCD with bcd_add against adding in binary and converting every update for
+ * the screen with the old pow()-based update_number. Both sides add the same points and must end up with the same
+ * value for SCORE_REG after every update
+ *
+ * @param result
+ * @param read_counter
+ * @param rounds
+ */
+void bench_score_update(core_bench_result_t *result, bench_counter_t read_counter, unsigned int rounds) {
+    unsigned char points[SCORE_UPDATES];
+    unsigned int new_shown[SCORE_UPDATES];
+    unsigned int old_shown[SCORE_UPDATES];
+    unsigned int score_bcd = 0;
+    unsigned int score = 0;
+    unsigned int random = 1;
+    unsigned int start = 0;
+
+    result->calls = 0;
+    result->new_ticks = 0;
+    result->old_ticks = 0;
+    result->matched = true;
+
+    for (unsigned int round = 0; round < rounds; round++) {
+        for (int i = 0; i < SCORE_UPDATES; i++) {
+            // xorshift, like the shape randomizer
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            points[i] = random % NUM_OF_BENCH_POINTS;
+        }
+        if (score > SCORE_RESTART) {
+            score = 0;
+            score_bcd = 0;
+        }
+
+        start = read_counter();
+        for (int i = 0; i < SCORE_UPDATES; i++) {
+            score_bcd = bcd_add(score_bcd, bench_points_bcd[points[i]]);
+            new_shown[i] = score_bcd;
+        }
+        result->new_ticks += read_counter() - start;
+
+        start = read_counter();
+        for (int i = 0; i < SCORE_UPDATES; i++) {
+            score += bench_points[points[i]];
+            old_shown[i] = old_update_number(score);
+        }
+        result->old_ticks += read_counter() - start;
+
+        for (int i = 0; i < SCORE_UPDATES; i++) {
+            if (new_shown[i] != old_shown[i]) {
+                result->matched = false;
+            }
+        }
+        result->calls += SCORE_UPDATES;
+    }
+}
+
+/**
+ * @brief the old update_number(): formats a number so the RTL can show it, one decimal digit per 4 bits.
+ * Returns the value instead of writing it to a register
+ * @example input = 123; format sent to register needs to be: 0x123 thus each digit from the input is left shifted four bits
+ *
+ * @param number the numer to display on screen
+ * @return the value update_number wrote to the register
+ */
+unsigned int old_update_number(unsigned int number) {
+    unsigned short digits[6] = {0};
+    unsigned int new_number_format = 0;
+
+    // get each digits from number starting at the ones digit place and ending at the 100 thousand place
+    for (int i = 0; i < 6; i++) {
+        digits[i] = (number / ((int) pow( (double) 10, (double) i)) ) % 10;
+    }
+
+    new_number_format = ((digits[5] << 20) + (digits[4] << 16) + (digits[3] << 12) + (digits[2] << 8) + (digits[1] << 4) + (digits[0]));
+    return new_number_format;
+}
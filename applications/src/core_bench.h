@@ -0,0 +1,26 @@
+/**
+* Brief:
+* cycle counts of game core routines against the code they replaced, for the CORE_BENCH build of main.c (mcycle)
+* and game_core_bench -c on a PC. The replaced code is kept in here only to be measured, with its drawing and
+* register writes taken out so both sides do the same work. Like game_core, nothing in here touches a register;
+* the caller passes the counter to read
+**/
+#ifndef __CORE_BENCH__
+#define __CORE_BENCH__
+
+#include <stdbool.h>
+
+// reads a free running counter; mcycle on the board, nanoseconds on a PC
+typedef unsigned int (*bench_counter_t)(void);
+
+typedef struct core_bench_result {
+    unsigned int calls;       // calls timed on each side
+    unsigned int new_ticks;   // counter ticks of the current code
+    unsigned int old_ticks;   // counter ticks of the code it replaced
+    bool matched;             // both gave the same result on every call
+} core_bench_result_t;
+
+void bench_rotation(core_bench_result_t *result, bench_counter_t read_counter, unsigned int rounds);
+void bench_score_update(core_bench_result_t *result, bench_counter_t read_counter, unsigned int rounds);
+
+#endif
@@ -0,0 +1,627 @@
+/**
+* Brief:
+* tetris rules; see game_core.h. Only drops score for now, line clears do not
+**/
+#include "game_core.h"
+
+/** function declarations **/
+void shape_vertices(tetris_shape_obj_t *current_shape);
+void spawn_shape(game_state_t *game);
+tetris_shapes_t get_new_shape(game_state_t *game);
+bool collision_movement(const game_state_t *game, int movement_direction);
+bool rotate_shape(game_state_t *game);
+bool move_shape(game_state_t *game, int movement_direction);
+unsigned int drop_shape(game_state_t *game);
+unsigned int lock_shape(game_state_t *game);
+void line_clear(game_state_t *game);
+void shift_board_down(game_state_t *game, int bottom_row, int row_count);
+void update_column_tops(game_state_t *game);
+unsigned int hard_drop(game_state_t *game);
+void update_game_speed(game_state_t *game);
+
+/** hash tables **/
+// every orientation of every shape, in clock-wise order; the rotation point of each shape
+// is baked into where the blocks land inside the 4x4 box. col_bottoms is row_masks seen from below
+const shape_orientation_t shape_orientations[NUM_OF_TETRIS_SHAPES][NUM_OF_ORIENTATIONS] = {
+    [i_shape] = {
+        { {{0, 1}, {1, 1}, {2, 1}, {3, 1}}, {0x0, 0xF, 0x0, 0x0}, { 1,  1,  1,  1} },
+        { {{2, 0}, {2, 1}, {2, 2}, {2, 3}}, {0x4, 0x4, 0x4, 0x4}, {-1, -1,  3, -1} },
+        { {{3, 2}, {2, 2}, {1, 2}, {0, 2}}, {0x0, 0x0, 0xF, 0x0}, { 2,  2,  2,  2} },
+        { {{1, 3}, {1, 2}, {1, 1}, {1, 0}}, {0x2, 0x2, 0x2, 0x2}, {-1,  3, -1, -1} }
+    },
+    [j_shape] = {
+        { {{0, 1}, {1, 1}, {2, 1}, {2, 2}}, {0x0, 0x7, 0x4, 0x0}, { 1,  1,  2, -1} },
+        { {{1, 0}, {1, 1}, {1, 2}, {0, 2}}, {0x2, 0x2, 0x3, 0x0}, { 2,  2, -1, -1} },
+        { {{2, 1}, {1, 1}, {0, 1}, {0, 0}}, {0x1, 0x7, 0x0, 0x0}, { 1,  1,  1, -1} },
+        { {{1, 2}, {1, 1}, {1, 0}, {2, 0}}, {0x6, 0x2, 0x2, 0x0}, {-1,  2,  0, -1} }
+    },
+    [l_shape] = {
+        { {{0, 1}, {1, 1}, {2, 1}, {0, 2}}, {0x0, 0x7, 0x1, 0x0}, { 2,  1,  1, -1} },
+        { {{1, 0}, {1, 1}, {1, 2}, {0, 0}}, {0x3, 0x2, 0x2, 0x0}, { 0,  2, -1, -1} },
+        { {{2, 1}, {1, 1}, {0, 1}, {2, 0}}, {0x4, 0x7, 0x0, 0x0}, { 1,  1,  1, -1} },
+        { {{1, 2}, {1, 1}, {1, 0}, {2, 2}}, {0x2, 0x2, 0x6, 0x0}, {-1,  2,  2, -1} }
+    },
+    [o_shape] = {
+        { {{0, 0}, {1, 0}, {0, 1}, {1, 1}}, {0x3, 0x3, 0x0, 0x0}, { 1,  1, -1, -1} },
+        { {{0, 0}, {1, 0}, {0, 1}, {1, 1}}, {0x3, 0x3, 0x0, 0x0}, { 1,  1, -1, -1} },
+        { {{0, 0}, {1, 0}, {0, 1}, {1, 1}}, {0x3, 0x3, 0x0, 0x0}, { 1,  1, -1, -1} },
+        { {{0, 0}, {1, 0}, {0, 1}, {1, 1}}, {0x3, 0x3, 0x0, 0x0}, { 1,  1, -1, -1} }
+    },
+    [s_shape] = {
+        { {{1, 1}, {2, 1}, {0, 2}, {1, 2}}, {0x0, 0x6, 0x3, 0x0}, { 2,  2,  1, -1} },
+        { {{1, 1}, {1, 2}, {0, 0}, {0, 1}}, {0x1, 0x3, 0x2, 0x0}, { 1,  2, -1, -1} },
+        { {{1, 1}, {0, 1}, {2, 0}, {1, 0}}, {0x6, 0x3, 0x0, 0x0}, { 1,  1,  0, -1} },
+        { {{1, 1}, {1, 0}, {2, 2}, {2, 1}}, {0x2, 0x6, 0x4, 0x0}, {-1,  1,  2, -1} }
+    },
+    [t_shape] = {
+        { {{0, 1}, {1, 1}, {2, 1}, {1, 2}}, {0x0, 0x7, 0x2, 0x0}, { 1,  2,  1, -1} },
+        { {{1, 0}, {1, 1}, {1, 2}, {0, 1}}, {0x2, 0x3, 0x2, 0x0}, { 1,  2, -1, -1} },
+        { {{2, 1}, {1, 1}, {0, 1}, {1, 0}}, {0x2, 0x7, 0x0, 0x0}, { 1,  1,  1, -1} },
+        { {{1, 2}, {1, 1}, {1, 0}, {2, 1}}, {0x2, 0x6, 0x2, 0x0}, {-1,  2,  1, -1} }
+    },
+    [z_shape] = {
+        { {{0, 1}, {1, 1}, {1, 2}, {2, 2}}, {0x0, 0x3, 0x6, 0x0}, { 1,  2,  2, -1} },
+        { {{1, 0}, {1, 1}, {0, 1}, {0, 2}}, {0x2, 0x3, 0x1, 0x0}, { 2,  1, -1, -1} },
+        { {{2, 1}, {1, 1}, {1, 0}, {0, 0}}, {0x3, 0x6, 0x0, 0x0}, { 0,  1,  1, -1} },
+        { {{1, 2}, {1, 1}, {2, 1}, {2, 0}}, {0x4, 0x6, 0x2, 0x0}, {-1,  2,  1, -1} }
+    }
+};
+
+// column offsets tried, in order, when a rotation collides; the I shape is allowed to kick 2 columns.
+// The cos/sin rotation these tables replaced had no kicks and dropped any rotation that collided
+const signed char wall_kicks[NUM_OF_TETRIS_SHAPES][MAX_WALL_KICKS] = {
+    [i_shape] = {0, -1, 1, -2, 2},
+    [j_shape] = {0, -1, 1},
+    [l_shape] = {0, -1, 1},
+    [o_shape] = {0},
+    [s_shape] = {0, -1, 1},
+    [t_shape] = {0, -1, 1},
+    [z_shape] = {0, -1, 1}
+};
+
+const unsigned char wall_kick_count[NUM_OF_TETRIS_SHAPES] = {5, 3, 3, 1, 3, 3, 3};
+
+// frames between gravity drops for each level (Game Boy table); level 0 drops about once a second
+const unsigned char gravity_frames[MAX_GRAVITY_LEVEL + 1] = {
+    53, 49, 45, 41, 37, 33, 28, 22, 17, 11, 10, 9, 8, 7, 6, 6, 5, 5, 4, 4, 3
+};
+
+
+/**
+ * @brief empties the board, resets score, level and lines and spawns the first shape
+ *
+ * @param game
+ * @param seed  seeds the shape randomizer; the same seed always deals the same shapes, so a game can be replayed
+ */
+void game_init(game_state_t *game, unsigned int seed) {
+    for (int row = 0; row < GAME_BOARD_Y_MAX; row++) {
+        game->board_rows[row] = BOARD_EMPTY_ROW;
+        game->board_colors[row] = 0;
+    }
+    game->board_rows[GAME_BOARD_Y_MAX] = BOARD_FULL_ROW; // floor
+    for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
+        game->column_tops[col] = GAME_BOARD_Y_MAX;
+    }
+
+    game->score = 0;
+    game->level = 0;
+    game->lines = 0;
+    game->frames_since_drop = 0;
+    game->game_over = false;
+    game->line_count = 0;
+    game->random = (seed == 0) ? 1 : seed; // xorshift gets stuck at 0
+    game->bag_count = 0;
+    update_game_speed(game);
+
+    game->next_shape = get_new_shape(game);
+    spawn_shape(game);
+}
+
+/**
+ * @brief advances the game by one step. Rotate, left and right are applied first, then the shape
+ * drops by a hard drop, a soft drop or by gravity. When the shape locks, full lines are cleared and the next shape
+ * spawns in the same step; the game is over when a shape locks without ever moving down
+ *
+ * @param game
+ * @param input  GAME_INPUT_* bits
+ * @return GAME_EVENT_* bits; 0 once the game is over
+ */
+unsigned int game_step(game_state_t *game, unsigned int input) {
+    unsigned int events = 0;
+
+    if (game->game_over) {
+        return 0;
+    }
+
+    if ((input & GAME_INPUT_ROTATE) && rotate_shape(game)) {
+        events |= GAME_EVENT_MOVED;
+    }
+    if ((input & GAME_INPUT_LEFT) && move_shape(game, left)) {
+        events |= GAME_EVENT_MOVED;
+    }
+    if ((input & GAME_INPUT_RIGHT) && move_shape(game, right)) {
+        events |= GAME_EVENT_MOVED;
+    }
+
+    if (input & GAME_INPUT_FRAME) {
+        game->frames_since_drop++;
+    }
+
+    // hard or soft drop, otherwise let gravity pull the shape down
+    if (input & GAME_INPUT_HARD_DROP) {
+        events |= GAME_EVENT_SCORE | hard_drop(game);
+    }
+    else if (input & GAME_INPUT_SOFT_DROP) {
+        game->score = bcd_add(game->score, 1);
+        events |= GAME_EVENT_SCORE | drop_shape(game);
+    }
+    else if ((input & GAME_INPUT_FRAME) && (game->frames_since_drop >= game->drop_frames)) {
+        events |= drop_shape(game);
+    }
+
+    return events;
+}
+
+/**
+ * @brief looks up a cell in the packed color plane
+ *
+ * @param game
+ * @param row
+ * @param col
+ * @return 0 if the cell is empty, otherwise the tetris shape of the block + 1
+ */
+unsigned int board_cell_id(const game_state_t *game, int row, int col) {
+    return (game->board_colors[row] >> (COLOR_BITS * col)) & COLOR_FIELD_MASK;
+}
+
+/**
+ * @brief row the falling shape's origin would come to rest at if it dropped straight down (ghost shape, hard drop)
+ * Each column of the shape lands one row above the top of its board column, so the landing row is the closest of
+ * up to 4 column_tops lookups. That only holds when the shape is above the top of every column it covers; a shape
+ * slid under an overhang is probed down the board row by row instead
+ *
+ * @param game
+ * @return origin row of the shape's 4x4 box; the current origin row if it can not move down
+ */
+int landing_row(const game_state_t *game) {
+    const tetris_shape_obj_t *current_shape = &game->current_shape;
+    const signed char *col_bottoms = shape_orientations[current_shape->shape][current_shape->orientation].col_bottoms;
+    int origin_row = current_shape->origin.y;
+    int landing = GAME_BOARD_Y_MAX;
+    int top = 0;
+
+    for (int i = 0; i < SHAPE_BOX_SIZE; i++) {
+        if (col_bottoms[i] < 0) {
+            continue;
+        }
+
+        top = game->column_tops[current_shape->origin.x + i];
+        if (top <= origin_row + col_bottoms[i]) {
+            // under an overhang; the top of the column is above the shape
+            while (!collision_probe(game, current_shape->shape, current_shape->orientation,
+                                    current_shape->origin.x, origin_row + 1)) {
+                origin_row++;
+            }
+            return origin_row;
+        }
+        if (top - 1 - col_bottoms[i] < landing) {
+            landing = top - 1 - col_bottoms[i];
+        }
+    }
+
+    return landing;
+}
+
+/**
+ * @brief adds two packed BCD numbers without converting them to binary
+ * every digit is biased by 6 so a decimal carry shows up as a binary carry, then the bias
+ * is taken back out of the digits that did not carry
+ * @example bcd_add(0x199, 0x1) = 0x200
+ *
+ * @param bcd_a  packed BCD number
+ * @param bcd_b  packed BCD number
+ * @return bcd_a + bcd_b in packed BCD; saturates at BCD_MAX so the value on screen never wraps
+ */
+unsigned int bcd_add(unsigned int bcd_a, unsigned int bcd_b) {
+    unsigned int biased = bcd_a + 0x06666666;
+    unsigned int sum = biased + bcd_b;
+    unsigned int carries = sum ^ biased ^ bcd_b;           // bit 4n is set if digit n-1 carried out
+    unsigned int no_carry = ~carries & 0x11111110;         // digits that did not carry still hold the bias
+    unsigned int result = sum - ((no_carry >> 2) | (no_carry >> 3)); // 6 for each of those digits
+
+    if (result > BCD_MAX) {
+        return BCD_MAX;
+    }
+
+    return result;
+}
+
+/**
+ * @brief converts a packed BCD number of up to 8 digits back to binary
+ *
+ * @param bcd
+ * @return unsigned int
+ */
+unsigned int bcd_to_binary(unsigned int bcd) {
+    unsigned int binary = 0;
+
+    for (int shift = 28; shift >= 0; shift -= 4) {
+        binary = binary * 10 + ((bcd >> shift) & 0xF);
+    }
+    return binary;
+}
+
+/**
+ * @brief sets the number of frames between gravity drops for the current level
+ *
+ * @param game
+ */
+void update_game_speed(game_state_t *game) {
+    unsigned int level = bcd_to_binary(game->level);
+
+    if (level > MAX_GRAVITY_LEVEL) {
+        level = MAX_GRAVITY_LEVEL;
+    }
+    game->drop_frames = gravity_frames[level];
+}
+
+/**
+ * @brief Get the next shape object from a 7-bag: the bag is refilled with one of each shape once it is empty and
+ * every shape is drawn from it at random, so at most 12 other shapes come between two of the same. The pick is a 32-bit
+ * xorshift scaled to the shapes left with a multiply instead of a modulo, so it costs a handful of instructions
+ *
+ * @param game
+ * @return 0-6 where 0 = i shape ... 6 = z shape
+ */
+tetris_shapes_t get_new_shape(game_state_t *game) {
+    unsigned int random = game->random;
+    unsigned int pick = 0;
+    tetris_shapes_t shape;
+
+    if (game->bag_count == 0) {
+        for (int i = 0; i < NUM_OF_TETRIS_SHAPES; i++) {
+            game->bag[i] = i;
+        }
+        game->bag_count = NUM_OF_TETRIS_SHAPES;
+    }
+
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    game->random = random;
+
+    // top 16 bits times the shapes left, >> 16 = 0 to bag_count - 1; the bias is under 1 in 9000
+    pick = ((random >> 16) * game->bag_count) >> 16;
+    shape = game->bag[pick];
+    game->bag[pick] = game->bag[--game->bag_count];
+
+    return shape;
+}
+
+/**
+ * @brief makes next_shape the falling shape at the spawn position and picks a new next_shape
+ *
+ * @param game
+ */
+void spawn_shape(game_state_t *game) {
+    tetris_shape_obj_t *current_shape = &game->current_shape;
+
+    current_shape->shape = game->next_shape;
+    current_shape->orientation = 0;
+    current_shape->origin.x = SPAWN_ORIGIN_COL;
+    current_shape->origin.y = SPAWN_ORIGIN_ROW;
+    current_shape->is_not_locked = true;
+    current_shape->lines_moved = 0;
+    shape_vertices(current_shape);
+
+    game->next_shape = get_new_shape(game);
+    game->frames_since_drop = 0;
+}
+
+/**
+ * @brief Each shape has four blocks. This function will set the (col, row) position on the virtual board
+ * for each block in shape by looking up the shape's current orientation and offsetting it by the shape origin
+ *
+ * @param current_shape
+ */
+void shape_vertices(tetris_shape_obj_t *current_shape) {
+    const shape_orientation_t *orientation = &shape_orientations[current_shape->shape][current_shape->orientation];
+
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        current_shape->blocks[i].x = current_shape->origin.x + orientation->blocks[i].x;
+        current_shape->blocks[i].y = current_shape->origin.y + orientation->blocks[i].y;
+    }
+}
+
+/**
+ * @brief rotates all the points of the shape CLOCK-WISE by 90 degrees
+ * the rotated blocks come from the next entry in shape_orientations; if they collide, the
+ * shape's wall_kicks are tried before the rotation is rejected
+ *
+ * @param game
+ * @return true if the shape rotated
+ */
+bool rotate_shape(game_state_t *game) {
+    tetris_shape_obj_t *current_shape = &game->current_shape;
+
+    if (current_shape->shape == o_shape)
+        return false;
+
+    unsigned int new_orientation = (current_shape->orientation + 1) % NUM_OF_ORIENTATIONS;
+    int new_col = 0;
+
+    // try the rotation in place first, then nudge it sideways off walls and other blocks
+    for (int kick = 0; kick < wall_kick_count[current_shape->shape]; kick++) {
+        new_col = current_shape->origin.x + wall_kicks[current_shape->shape][kick];
+
+        if (!collision_probe(game, current_shape->shape, new_orientation, new_col, current_shape->origin.y)) {
+            current_shape->orientation = new_orientation;
+            current_shape->origin.x = new_col;
+            shape_vertices(current_shape);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief moves current shape one block left, right or down
+ *
+ * @param game
+ * @param movement_direction  left, right or down
+ * @return true if the shape moved
+ */
+bool move_shape(game_state_t *game, int movement_direction) {
+    tetris_shape_obj_t *current_shape = &game->current_shape;
+
+    if (collision_movement(game, movement_direction)) {
+        return false;
+    }
+
+    // update origin and recompute the blocks from the orientation table
+    switch (movement_direction) {
+        case left:
+            current_shape->origin.x -= 1;
+            break;
+        case right:
+            current_shape->origin.x += 1;
+            break;
+        case down:
+            current_shape->origin.y += 1;
+            current_shape->lines_moved++;
+            break;
+    }
+    shape_vertices(current_shape);
+
+    return true;
+}
+
+/**
+ * @brief drops current shape straight to its landing row and locks it there; scores 1 point per row like a soft drop
+ *
+ * @param game
+ * @return GAME_EVENT_* bits
+ */
+unsigned int hard_drop(game_state_t *game) {
+    tetris_shape_obj_t *current_shape = &game->current_shape;
+    unsigned int rows = landing_row(game) - current_shape->origin.y;
+
+    // rows is at most GAME_BOARD_Y_MAX, so two BCD digits
+    game->score = bcd_add(game->score, ((rows / 10) << 4) | (rows % 10));
+    current_shape->origin.y += rows;
+    current_shape->lines_moved += rows;
+    shape_vertices(current_shape);
+
+    return lock_shape(game);
+}
+
+/**
+ * @brief moves current shape down one row, or locks it in place if it can not move down
+ *
+ * @param game
+ * @return GAME_EVENT_* bits
+ */
+unsigned int drop_shape(game_state_t *game) {
+    game->frames_since_drop = 0;
+
+    if (move_shape(game, down)) {
+        return GAME_EVENT_MOVED;
+    }
+
+    return lock_shape(game);
+}
+
+/**
+ * @brief
+ * Detect if a movement in direction will cause a collision
+ *
+ * @param game
+ * @param movement_direction
+ * 0 = moving left
+ * 1 = moving right
+ * 2 = moving down
+ */
+bool collision_movement(const game_state_t *game, int movement_direction) {
+    const tetris_shape_obj_t *current_shape = &game->current_shape;
+    int origin_col = current_shape->origin.x;
+    int origin_row = current_shape->origin.y;
+
+    switch (movement_direction) {
+        case left:
+            origin_col--;
+            break;
+        case right:
+            origin_col++;
+            break;
+        case down:
+            origin_row++;
+            break;
+    }
+
+    return collision_probe(game, current_shape->shape, current_shape->orientation, origin_col, origin_row);
+}
+
+/**
+ * @brief
+ * Detect if a shape placed at the given origin and orientation would overlap the walls, the floor, or a locked block.
+ * Each row mask of the orientation is shifted into board columns and AND'ed against the bitboard.
+ *
+ * @param game
+ * @param shape       i - z shape
+ * @param orientation index into shape_orientations[shape]
+ * @param origin_col  board column of the top left corner of the shape's 4x4 box
+ * @param origin_row  board row of the top left corner of the shape's 4x4 box
+ */
+bool collision_probe(const game_state_t *game, tetris_shapes_t shape, unsigned int orientation, int origin_col, int origin_row) {
+    const unsigned char *row_masks = shape_orientations[shape][orientation].row_masks;
+    unsigned int board_row = 0;
+    int row = 0;
+
+    // the 4x4 box can only stick out WALL_MARGIN columns past the left wall before every block is off the board
+    if (origin_col < -(BOARD_COL_SHIFT + WALL_MARGIN)) {
+        return true;
+    }
+
+    for (int i = 0; i < SHAPE_BOX_SIZE; i++) {
+        if (row_masks[i] == 0) {
+            continue;
+        }
+
+        // the floor is the last row of board_rows; anything above or below the board collides
+        row = origin_row + i;
+        if ((row < GAME_BOARD_Y_MIN) || (row > GAME_BOARD_Y_MAX)) {
+            return true;
+        }
+
+        // widen the left wall so blocks further left than column -1 still hit it
+        board_row = ((unsigned int) game->board_rows[row] << WALL_MARGIN) | ((1 << WALL_MARGIN) - 1);
+        if (((unsigned int) row_masks[i] << (origin_col + BOARD_COL_SHIFT + WALL_MARGIN)) & board_row) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief writes the shape into the virtual board once it can not move down anymore, clears full lines
+ * and spawns the next shape, also after the lock that ends the game. The drop speed is set from the level
+ * before the lines are cleared, so a new level speeds up the shape after the next one
+ *
+ * @param game
+ * @return GAME_EVENT_* bits
+ */
+unsigned int lock_shape(game_state_t *game) {
+    tetris_shape_obj_t *current_shape = &game->current_shape;
+    unsigned int events = GAME_EVENT_LOCKED;
+    int row, col;
+
+    current_shape->is_not_locked = false;
+    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+        row = current_shape->blocks[i].y;
+        col = current_shape->blocks[i].x;
+
+        game->board_rows[row] |= CELL_MASK(col);
+        game->board_colors[row] |= (current_shape->shape + 1) << (COLOR_BITS * col);
+        if (row < game->column_tops[col]) {
+            game->column_tops[col] = row;
+        }
+    }
+    game->locked_shape = *current_shape;
+
+    // if the shape locks where it spawned then its Game Over
+    if (current_shape->lines_moved == 0) {
+        game->game_over = true;
+        events |= GAME_EVENT_GAME_OVER;
+    }
+
+    update_game_speed(game);
+    line_clear(game);
+    if (game->line_count > 0) {
+        events |= GAME_EVENT_LINES | GAME_EVENT_SCORE;
+    }
+
+    spawn_shape(game);
+    events |= GAME_EVENT_SPAWNED;
+
+    return events;
+}
+
+/**
+ * @brief find how many lines are complete and clears them. Updates lines and level
+ *
+ * @param game
+ */
+void line_clear(game_state_t *game) {
+    unsigned int line_count = 0;
+
+    // find the rows that are full; a full row has every column bit set along with the walls
+    for (int row = GAME_BOARD_Y_MAX - 1; (row > GAME_BOARD_Y_MIN) && (line_count < MAX_LINES_PER_CLEAR); row--) {
+        if (game->board_rows[row] == BOARD_FULL_ROW) {
+            game->cleared_rows[line_count] = row;
+            game->cleared_colors[line_count] = game->board_colors[row];
+            line_count++;
+        }
+    }
+
+    game->line_count = line_count;
+    if (line_count == 0) {
+        return;
+    }
+
+    // remove the lines starting from the highest band of adjacent lines; cleared_rows goes from the bottom up
+    for (int i = line_count-1; i >= 0; ) {
+        int band = 1;
+
+        while ((i - band >= 0) && (game->cleared_rows[i - band] == game->cleared_rows[i] + band)) {
+            band++;
+        }
+        shift_board_down(game, game->cleared_rows[i] + band - 1, band);
+        i -= band;
+    }
+    update_column_tops(game);
+
+    // level = lines / 10, which in BCD is dropping the ones digit
+    game->lines = bcd_add(game->lines, line_count);
+    game->level = game->lines >> 4;
+}
+
+/**
+ * @brief moves every row above a band of cleared rows down by the size of the band
+ *
+ * @param game
+ * @param bottom_row  lowest row of the band
+ * @param row_count   number of rows in the band
+ */
+void shift_board_down(game_state_t *game, int bottom_row, int row_count) {
+    for (int row = bottom_row; row >= GAME_BOARD_Y_MIN; row--) {
+        if (row - row_count >= GAME_BOARD_Y_MIN) {
+            game->board_rows[row] = game->board_rows[row - row_count];
+            game->board_colors[row] = game->board_colors[row - row_count];
+        }
+        else {
+            game->board_rows[row] = BOARD_EMPTY_ROW;
+            game->board_colors[row] = 0;
+        }
+    }
+}
+
+/**
+ * @brief moves column_tops down after line_clear removed line_count rows
+ * the cleared rows were full, so every column's top was at or above the highest of them and everything above it
+ * came down by line_count rows. A top block that was not cleared is found right there; one that was cleared
+ * leaves the column to be walked down to the next block
+ *
+ * @param game
+ */
+void update_column_tops(game_state_t *game) {
+    for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
+        int row = game->column_tops[col] + game->line_count;
+
+        while ((row < GAME_BOARD_Y_MAX) && !(game->board_rows[row] & CELL_MASK(col))) {
+            row++;
+        }
+        game->column_tops[col] = row;
+    }
+}
@@ -0,0 +1,137 @@
+/**
+* Brief:
+* tetris rules without any drawing: board, falling shape, collision, locking, line clears, scoring,
+* level progression and the shape randomizer (7-bag). Nothing in here touches a register, so the same code
+* runs in the firmware and on a PC (see applications/host).
+*
+* The game advances one game_step() at a time. Each step takes a set of GAME_INPUT_* bits and returns
+* the GAME_EVENT_* bits of what changed, so the caller only redraws what the events say changed
+**/
+#ifndef __GAME_CORE__
+#define __GAME_CORE__
+
+#include <stdbool.h>
+
+/** game board boundaries **/
+#define GAME_BOARD_X_MIN 0
+#define GAME_BOARD_X_MAX 10
+#define GAME_BOARD_Y_MIN 0
+#define GAME_BOARD_Y_MAX 18
+
+/** bitboard layout **/
+// each board row is a 16-bit occupancy mask; game column c lives in bit (c + 1)
+// bit 0 and bits 15:11 are permanently set so they act as the left and right walls
+// an extra row below the board is fully set and acts as the floor
+#define BOARD_COL_SHIFT 1
+#define BOARD_EMPTY_ROW 0xF801  // walls only
+#define BOARD_FULL_ROW  0xFFFF  // walls + all 10 columns occupied
+#define CELL_MASK(col) (1 << ((col) + BOARD_COL_SHIFT))
+// color plane: 3 bits per cell packed into one word per row; 0 = empty, 1-7 = tetris shape + 1
+#define COLOR_BITS 3
+#define COLOR_FIELD_MASK 0x7
+
+/** shapes **/
+#define NUM_OF_TETRIS_SHAPES 7  // total numbers of tetris shapes
+#define BLOCKS_PER_SHAPE 4
+#define NUM_OF_ORIENTATIONS 4   // 0 = spawn orientation; each rotation turns the shape 90 degrees clock-wise
+#define SHAPE_BOX_SIZE 4        // every orientation fits in a 4x4 box of blocks whose top left corner is the shape origin
+#define SPAWN_ORIGIN_COL 3      // all shapes spawn with their origin at (row 0, col 3)
+#define SPAWN_ORIGIN_ROW 0
+#define MAX_WALL_KICKS 5
+#define WALL_MARGIN 3           // extra wall columns used when probing shapes that hang off the left side of the board
+
+/** other **/
+#define MAX_GRAVITY_LEVEL 20    // levels above this drop as fast as this level
+#define MAX_LINES_PER_CLEAR 4
+#define BCD_MAX 0x999999 // largest value the 6 digit score, level and lines sections can show
+
+/** game_step inputs; applied in this order **/
+#define GAME_INPUT_ROTATE    0x01
+#define GAME_INPUT_LEFT      0x02
+#define GAME_INPUT_RIGHT     0x04
+#define GAME_INPUT_SOFT_DROP 0x08 // drop one row and score 1 point; gravity is skipped this step
+#define GAME_INPUT_FRAME     0x10 // one frame went by; gravity drops the shape every drop_frames frames
+#define GAME_INPUT_HARD_DROP 0x20 // drop straight to landing_row(), score 1 point per row and lock; takes the place of the soft drop and gravity
+
+/** game_step events **/
+#define GAME_EVENT_MOVED     0x01 // current_shape moved or rotated
+#define GAME_EVENT_LOCKED    0x02 // current_shape was written into the board
+#define GAME_EVENT_LINES     0x04 // line_count rows were cleared, see cleared_rows
+#define GAME_EVENT_SPAWNED   0x08 // current_shape and next_shape are new
+#define GAME_EVENT_SCORE     0x10 // score, level or lines changed
+#define GAME_EVENT_GAME_OVER 0x20
+
+/** enums, struct, others **/
+typedef enum tetris_shapes {
+    i_shape,
+    j_shape,
+    l_shape,
+    o_shape,
+    s_shape,
+    t_shape,
+    z_shape
+} tetris_shapes_t;
+
+typedef enum move_dir {
+    left,
+    right,
+    down
+} move_dir_t;
+
+typedef struct vertex {
+    short int x;
+    short int y;
+} vertex_t;
+
+typedef struct shape_orientation {
+    vertex_t blocks[BLOCKS_PER_SHAPE];       // (col, row) offset of each block from the shape origin
+    unsigned char row_masks[SHAPE_BOX_SIZE]; // occupancy of each row of the 4x4 box; bit n = col offset n
+    signed char col_bottoms[SHAPE_BOX_SIZE]; // row offset of the lowest block in each col of the 4x4 box; -1 = no block
+} shape_orientation_t;
+
+typedef struct tetris_shape_obj {
+    tetris_shapes_t shape;
+    vertex_t blocks[BLOCKS_PER_SHAPE]; // 4 blocks for each shape; (col, row) position on the virtual board
+    vertex_t origin;                   // top left corner of the shape's 4x4 box on the virtual board
+    unsigned int orientation;          // index into shape_orientations[shape]
+    bool is_not_locked;
+    unsigned int lines_moved;
+} tetris_shape_obj_t;
+
+typedef struct game_state {
+    // virtual board; only holds blocks that are locked in place, the falling shape is current_shape
+    unsigned short int board_rows[GAME_BOARD_Y_MAX + 1];  // occupancy masks; last row is the floor
+    unsigned int board_colors[GAME_BOARD_Y_MAX];          // packed color ids, see COLOR_BITS
+    // highest locked block of each column, GAME_BOARD_Y_MAX (the floor) if the column is empty; kept up to date
+    // on lock and line clear so landing_row() does not have to walk the board
+    unsigned char column_tops[GAME_BOARD_X_MAX];
+    tetris_shape_obj_t current_shape;
+    tetris_shape_obj_t locked_shape;  // where the shape of the last GAME_EVENT_LOCKED came to rest
+    tetris_shapes_t next_shape;
+    unsigned int score;  // score, level and lines are kept in packed BCD so they can be written to the screen as is
+    unsigned int level;
+    unsigned int lines;
+    unsigned int drop_frames;       // frames between gravity drops at this level
+    unsigned int frames_since_drop;
+    unsigned int random;            // xorshift state of the shape randomizer; never 0
+    // 7-bag: every shape is dealt once before any shape is dealt again; bag[0..bag_count-1] are the ones left
+    unsigned char bag[NUM_OF_TETRIS_SHAPES];
+    unsigned int bag_count;
+    bool game_over;
+    // rows removed by the last GAME_EVENT_LINES, from the bottom up, and their colors before they were removed
+    unsigned int line_count;
+    int cleared_rows[MAX_LINES_PER_CLEAR];
+    unsigned int cleared_colors[MAX_LINES_PER_CLEAR];
+} game_state_t;
+
+extern const shape_orientation_t shape_orientations[NUM_OF_TETRIS_SHAPES][NUM_OF_ORIENTATIONS];
+
+void game_init(game_state_t *game, unsigned int seed);
+unsigned int game_step(game_state_t *game, unsigned int input);
+unsigned int board_cell_id(const game_state_t *game, int row, int col);
+int landing_row(const game_state_t *game);
+bool collision_probe(const game_state_t *game, tetris_shapes_t shape, unsigned int orientation, int origin_col, int origin_row);
+unsigned int bcd_add(unsigned int bcd_a, unsigned int bcd_b);
+unsigned int bcd_to_binary(unsigned int bcd);
+
+#endif
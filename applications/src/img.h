@@ -1,301 +1,549 @@
 #ifndef __IMG__
 #define __IMG__
 
-unsigned short int main_menu[144][160] = {
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0x55c, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xfff, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xfff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfd0, 0xf0, 0xfd0, 0xf0, 0xfd0, 0xf0, 0xfd0, 0xf0, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xf, 0xf0f, 0xf, 0xf, 0xf, 0xf, 0xf, 0xfff, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xfff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xfff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf0, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xfd0, 0xf0, 0xfd0, 0xf0, 0xfd0, 0xf0, 0xfd0, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xfff, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xfff, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xfff, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xfff, 0xfff, 0xfff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xfff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf0, 0xfff, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xfff, 0xfd0, 0xf0, 0xfd0, 0xf0, 0xfd0, 0xf0, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xfff, 0xfff, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xfff, 0xfff, 0xf, 0xf, 0xf, 0xf, 0xf, 0xfff, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xfff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfff, 0xfff, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xfff, 0xfff, 0xfd0, 0xf0, 0xfd0, 0xf0, 0xfd0, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xfff, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf0f, 0xf0f, 0xf0f, 0xfff, 0xfff, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xfff, 0xfff, 0xf, 0xf, 0xf, 0xf, 0xfff, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xfff, 0xf0, 0xff, 0xf0, 0xff, 0xfff, 0xfff, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xfff, 0xfff, 0xfd0, 0xf0, 0xfd0, 0xf0, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xf90, 0xf90, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xfff, 0xf00, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf0f, 0xf0f, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xf, 0xf, 0xf, 0xfff, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xff, 0xfff, 0xa, 0xfff, 0xff, 0xf0, 0xff, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xfd0, 0xf0, 0xfd0, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xf90, 0xfff, 0xfff, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xfff, 0xf90, 0xf00, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xf00, 0xf0f, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf0f, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf, 0xf, 0xfff, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xfff, 0xf0, 0xff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfd0, 0xf0, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xf90, 0xf90, 0xfff, 0xfff, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xfff, 0xf00, 0xf90, 0xf00, 0xf00, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf, 0xfff, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xfff, 0xff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfd0, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xf90, 0xfff, 0xfff, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xfff, 0xf90, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xf90, 0xf90, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xfff, 0xfff, 0xf90, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xfff, 0xfff, 0xfff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xfff, 0xf, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf0f, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf0f, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xfff, 0xf, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xfff, 0xfff, 0xfff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xa, 0xfff, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf00, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf00, 0xf0f, 0xf00, 0xf0f, 0xf00, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xa, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xf0f, 0xf00, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xf0f, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xa, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xfff, 0xfff, 0xfff, 0xfff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xf0f, 0xf, 0xf0f, 0xf, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xff, 0xf, 0xff, 0xf, 0xff, 0xfff, 0xfff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf90, 0xf90, 0xf00, 0xf90, 0xfff, 0xa, 0xa, 0xfff, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0f, 0xf, 0xf0f, 0xf, 0xf0f, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfd0, 0xfff, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xfd0, 0xf90, 0xf90, 0xf90, 0xfff, 0xfff, 0xa, 0xfff, 0xf90, 0xf90, 0xf00, 0xf90, 0xf00, 0xfff, 0xa, 0xa, 0xfff, 0xf90, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xf00, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xfff, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0xaae, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0xe12, 0xe12, 0xe12, 0xe12, 0xe12, 0xe12, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0xe12, 0xe12, 0xe12, 0xe12, 0xe12, 0xe12, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0xe12, 0xe12, 0xe12, 0xe12, 0xe12, 0xe12, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0xe12, 0xe12, 0xe12, 0xe12, 0xe12, 0xe12, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xcf, 0xcf, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}, 
-	{0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0x6d9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3}
+// palette-indexed, run-length-encoded 160x144 image; made by backups/graphics/vga_img_generator/img_to_pixel.py
+// each run byte is (palette index << run_bits) | (run length - 1); runs never cross a row
+typedef struct rle_image {
+    const unsigned short int *palette; // 12-bit colors; loaded into the palette of vga_top as is, so at most 16
+    unsigned int palette_size;
+    const unsigned short int *rows;    // index of the first run of each row
+    const unsigned char *runs;
+    unsigned int run_bits;
+} rle_image_t;
+
+// main_menu: 160x144, 16 colors, 3589 runs; generated by img_to_pixel.py
+const unsigned short int main_menu_palette[16] = {
+	0xa, 0xfff, 0x93, 0x72, 0xb3, 0x6d9, 0xfd0, 0xff, 0xaae, 0xf00, 0xf, 0xf0, 0xf0f, 0x55c, 0x0, 0xe12
+};
+const unsigned short int main_menu_rows[144] = {
+	0, 30, 60, 90, 120, 150, 180, 210, 240, 253, 266, 279, 292, 307, 322, 337,
+	353, 369, 385, 409, 478, 555, 627, 701, 782, 858, 931, 1001, 1060, 1119, 1175, 1224,
+	1274, 1323, 1373, 1430, 1485, 1543, 1600, 1655, 1708, 1757, 1806, 1854, 1902, 1923, 1937, 1951,
+	1965, 1979, 1993, 2009, 2025, 2041, 2057, 2073, 2090, 2107, 2123, 2140, 2157, 2174, 2190, 2207,
+	2224, 2241, 2258, 2274, 2291, 2308, 2325, 2341, 2358, 2375, 2396, 2417, 2440, 2461, 2482, 2496,
+	2510, 2524, 2537, 2550, 2561, 2572, 2583, 2594, 2605, 2619, 2633, 2647, 2661, 2675, 2689, 2703,
+	2717, 2731, 2759, 2794, 2829, 2857, 2890, 2919, 2933, 2947, 2961, 2975, 2989, 3003, 3017, 3031,
+	3045, 3059, 3073, 3087, 3101, 3115, 3129, 3143, 3157, 3171, 3185, 3199, 3213, 3227, 3241, 3255,
+	3269, 3289, 3309, 3329, 3349, 3369, 3389, 3409, 3429, 3449, 3469, 3489, 3509, 3529, 3549, 3569
+};
+const unsigned char main_menu_runs[3589] = {
+	0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45,
+	0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27,
+	0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41,
+	0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45,
+	0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27,
+	0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41,
+	0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45,
+	0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27,
+	0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41,
+	0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45,
+	0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27, 0x31, 0x45, 0x57, 0x41, 0x35, 0x27,
+	0x31, 0x45, 0x57, 0x41, 0x25, 0x37, 0x21, 0x55, 0x47, 0x51, 0x25, 0x37, 0x21, 0x55, 0x47, 0x51,
+	0x25, 0x37, 0x21, 0x55, 0x47, 0x51, 0x25, 0x37, 0x21, 0x55, 0x47, 0x51, 0x25, 0x37, 0x21, 0x55,
+	0x47, 0x51, 0x25, 0x37, 0x21, 0x55, 0x47, 0x51, 0x25, 0x37, 0x21, 0x55, 0x47, 0x51, 0x25, 0x37,
+	0x21, 0x55, 0x47, 0x51, 0x25, 0x37, 0x21, 0x55, 0x47, 0x51, 0x25, 0x37, 0x21, 0x55, 0x47, 0x51,
+	0x25, 0x31, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x35, 0x21, 0x25, 0x31, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x35, 0x21, 0x25, 0x31, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0x35, 0x21, 0x25, 0x31, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0xf, 0x35, 0x21, 0x25, 0x31, 0x5, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xd2,
+	0x6, 0x35, 0x21, 0x25, 0x31, 0x5, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x13, 0x5,
+	0x35, 0x21, 0x35, 0x21, 0x5, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x13, 0x5, 0x25,
+	0x31, 0x35, 0x21, 0x5, 0x11, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x25,
+	0x31, 0x45, 0x51, 0x5, 0x11, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x25,
+	0x31, 0x45, 0x51, 0x5, 0x11, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x25,
+	0x31, 0x45, 0x51, 0x5, 0x11, 0x6, 0x1f, 0x16, 0x0, 0x1f, 0x11, 0x0, 0x1f, 0x16, 0x0, 0x1c,
+	0x5, 0x16, 0x3, 0x1e, 0x8, 0x11, 0x5, 0x25, 0x31, 0x45, 0x51, 0x5, 0x11, 0x6, 0x10, 0xc8,
+	0xa0, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0xa5, 0x10, 0x0, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x70,
+	0xa0, 0x78, 0x10, 0x0, 0x10, 0xb0, 0x70, 0xb0, 0x70, 0xb8, 0x60, 0xb0, 0x60, 0xb0, 0x60, 0xb0,
+	0x60, 0xb0, 0x10, 0x0, 0x10, 0x64, 0x10, 0x64, 0x12, 0x3, 0x10, 0x61, 0x90, 0x60, 0x90, 0x10,
+	0x2, 0x15, 0x93, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x10, 0x8, 0x11, 0x5, 0x25, 0x31, 0x45, 0x51,
+	0x5, 0x11, 0x6, 0x10, 0xc6, 0x10, 0xa0, 0xc0, 0xa0, 0xc0, 0xa0, 0x10, 0xa0, 0xc0, 0xa4, 0x10,
+	0x0, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70, 0x11, 0xa0, 0x77, 0x10, 0x0, 0x10, 0x70, 0xb0, 0x70,
+	0xb0, 0x70, 0xb1, 0x10, 0xb4, 0x10, 0x60, 0xb0, 0x60, 0xb0, 0x60, 0xb0, 0x60, 0x10, 0x0, 0x10,
+	0x64, 0x10, 0x66, 0x11, 0x2, 0x10, 0x62, 0x90, 0x60, 0x10, 0x1, 0x11, 0x3, 0x11, 0x91, 0xc0,
+	0x90, 0xc0, 0x90, 0xc0, 0x90, 0x10, 0x8, 0x11, 0x5, 0x25, 0x31, 0x45, 0x51, 0x5, 0x11, 0x6,
+	0x10, 0xc5, 0x11, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0x11, 0xa5, 0x10, 0x0, 0x10, 0xa0, 0x70, 0xa0,
+	0x70, 0xa0, 0x13, 0x76, 0x10, 0x0, 0x10, 0xb0, 0x70, 0xb0, 0x70, 0xb1, 0x11, 0xb4, 0x11, 0x60,
+	0xb0, 0x60, 0xb0, 0x60, 0xb0, 0x10, 0x0, 0x10, 0x64, 0x10, 0x67, 0x11, 0x1, 0x10, 0x61, 0x90,
+	0x60, 0x90, 0x10, 0x1, 0x11, 0x4, 0x11, 0x91, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x10, 0x8, 0x11,
+	0x5, 0x25, 0x31, 0x55, 0x41, 0x5, 0x11, 0x6, 0x10, 0xc4, 0x12, 0xa0, 0xc0, 0xa0, 0xc0, 0xa0,
+	0x12, 0xa4, 0x10, 0x0, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70, 0x10, 0x1, 0x12, 0x74, 0x10, 0x0,
+	0x10, 0x70, 0xb0, 0x70, 0xb0, 0x70, 0x12, 0xb4, 0x12, 0x60, 0xb0, 0x60, 0xb0, 0x60, 0x10, 0x0,
+	0x10, 0x64, 0x10, 0x67, 0x11, 0x1, 0x10, 0x62, 0x90, 0x60, 0x10, 0x0, 0x10, 0x60, 0x11, 0x4,
+	0x11, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0x10, 0x8, 0x11, 0x5, 0x35, 0x21, 0x55, 0x41, 0x5,
+	0x11, 0x6, 0x10, 0xc3, 0x11, 0x0, 0x10, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0x10, 0x0, 0x11, 0xa3,
+	0x10, 0x0, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x10, 0x3, 0x12, 0x72, 0x10, 0x0, 0x10, 0xb0,
+	0x70, 0xb0, 0x70, 0x11, 0x0, 0x10, 0xb4, 0x10, 0x0, 0x11, 0x60, 0xb0, 0x60, 0xb0, 0x10, 0x0,
+	0x10, 0x64, 0x10, 0x68, 0x10, 0x1, 0x10, 0x61, 0x90, 0x60, 0x90, 0x10, 0x0, 0x10, 0x90, 0x60,
+	0x11, 0x4, 0x11, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x10, 0x8, 0x11, 0x5, 0x35, 0x21, 0x55, 0x41,
+	0x5, 0x11, 0x6, 0x10, 0xc2, 0x11, 0x1, 0x10, 0xa0, 0xc0, 0xa0, 0xc0, 0xa0, 0x10, 0x1, 0x11,
+	0xa2, 0x10, 0x0, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70, 0x10, 0x5, 0x12, 0x70, 0x10, 0x0, 0x10,
+	0x70, 0xb0, 0x70, 0x11, 0x1, 0x10, 0xb4, 0x10, 0x1, 0x11, 0x60, 0xb0, 0x60, 0x10, 0x0, 0x10,
+	0x64, 0x10, 0x68, 0x11, 0x0, 0x10, 0x62, 0x90, 0x60, 0x10, 0x0, 0x10, 0x60, 0x91, 0x11, 0x4,
+	0x12, 0x90, 0xc0, 0x90, 0x10, 0x8, 0x11, 0x5, 0x35, 0x21, 0x55, 0x41, 0x5, 0x11, 0x6, 0x10,
+	0xc1, 0x11, 0x2, 0x10, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0x10, 0x2, 0x11, 0xa1, 0x10, 0x0, 0x10,
+	0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x10, 0x7, 0x12, 0x0, 0x10, 0xb0, 0x70, 0x11, 0x2, 0x10, 0xb4,
+	0x10, 0x2, 0x11, 0x60, 0xb0, 0x10, 0x0, 0x10, 0x64, 0x10, 0x68, 0x11, 0x0, 0x10, 0x61, 0x90,
+	0x60, 0x90, 0x10, 0x0, 0x10, 0x90, 0x60, 0x91, 0x12, 0x4, 0x11, 0x90, 0xc0, 0x10, 0x8, 0x11,
+	0x5, 0x35, 0x21, 0x55, 0x41, 0x5, 0x11, 0x6, 0x10, 0xc0, 0x11, 0x3, 0x10, 0xa0, 0xc0, 0xa0,
+	0xc0, 0xa0, 0x10, 0x3, 0x11, 0xa0, 0x10, 0x0, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70, 0x10, 0x4,
+	0x10, 0x3, 0x10, 0x0, 0x10, 0x70, 0x11, 0x3, 0x10, 0xb4, 0x10, 0x3, 0x11, 0x60, 0x10, 0x0,
+	0x10, 0x64, 0x10, 0x68, 0x11, 0x0, 0x10, 0x62, 0x90, 0x60, 0x10, 0x0, 0x10, 0x60, 0x94, 0x11,
+	0x4, 0x11, 0x90, 0x10, 0x8, 0x11, 0x5, 0x35, 0x21, 0x55, 0x41, 0x5, 0x11, 0x6, 0x12, 0x4,
+	0x10, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0x10, 0x4, 0x12, 0x0, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0,
+	0x10, 0x2, 0x12, 0x5, 0x12, 0x4, 0x10, 0xb4, 0x10, 0x4, 0x12, 0x0, 0x10, 0x64, 0x10, 0x68,
+	0x10, 0x1, 0x10, 0x61, 0x90, 0x60, 0x90, 0x10, 0x0, 0x11, 0x60, 0x94, 0x11, 0x4, 0x12, 0x8,
+	0x11, 0x5, 0x35, 0x21, 0x55, 0x41, 0x5, 0x11, 0x6, 0x11, 0x5, 0x10, 0xa0, 0xc0, 0xa0, 0xc0,
+	0xa0, 0x10, 0x5, 0x11, 0x0, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70, 0x10, 0x1, 0x11, 0x70, 0x10,
+	0x5, 0x11, 0x5, 0x10, 0xb4, 0x10, 0x5, 0x11, 0x0, 0x10, 0x64, 0x10, 0x67, 0x11, 0x1, 0x10,
+	0x62, 0x90, 0x60, 0x10, 0x1, 0x11, 0x95, 0x11, 0x4, 0x11, 0x8, 0x11, 0x5, 0x35, 0x21, 0x55,
+	0x41, 0x5, 0x11, 0x6, 0x10, 0x6, 0x10, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0x10, 0x6, 0x10, 0x0,
+	0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x13, 0x71, 0x10, 0x5, 0x10, 0x6, 0x10, 0xb4, 0x10, 0x6,
+	0x10, 0x0, 0x10, 0x64, 0x10, 0x67, 0x11, 0x1, 0x10, 0x61, 0x90, 0x60, 0x90, 0x10, 0x2, 0x11,
+	0x95, 0x12, 0xd, 0x11, 0x5, 0x35, 0x21, 0x45, 0x51, 0x5, 0x11, 0xe, 0x10, 0xa0, 0xc0, 0xa0,
+	0xc0, 0xa0, 0x10, 0x8, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70, 0x11, 0xa0, 0x72, 0x10, 0xd, 0x10,
+	0xb4, 0x10, 0x8, 0x10, 0x64, 0x10, 0x66, 0x11, 0x2, 0x10, 0x62, 0x90, 0x60, 0x10, 0x3, 0x11,
+	0x95, 0xc0, 0x11, 0xc, 0x11, 0x5, 0x25, 0x31, 0x45, 0x51, 0x5, 0x11, 0xe, 0x10, 0xc0, 0xa0,
+	0xc0, 0xa0, 0xc0, 0x10, 0x8, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x10, 0xa0, 0x73, 0x10, 0xd,
+	0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x10, 0x64, 0x12, 0x3, 0x10, 0x61, 0x90, 0x60, 0x90, 0x10,
+	0x4, 0x11, 0x95, 0xc0, 0x11, 0xb, 0x11, 0x5, 0x25, 0x31, 0x35, 0x21, 0x5, 0x11, 0xe, 0x10,
+	0xa0, 0xc0, 0xa0, 0xc0, 0xa0, 0x10, 0x8, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70, 0x11, 0xa0, 0x72,
+	0x10, 0xd, 0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x16, 0x5, 0x10, 0x62, 0x90, 0x60, 0x10, 0x5,
+	0x11, 0x93, 0xc0, 0x90, 0xc0, 0x12, 0x9, 0x11, 0x5, 0x25, 0x31, 0x35, 0x21, 0x5, 0x11, 0xe,
+	0x10, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0x10, 0x8, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x13, 0x71,
+	0x10, 0xd, 0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x12, 0x9, 0x10, 0x61, 0x90, 0x60, 0x90, 0x10,
+	0x6, 0x11, 0x93, 0xc0, 0x90, 0xc0, 0x90, 0x11, 0x8, 0x11, 0x5, 0x25, 0x31, 0x35, 0x21, 0x5,
+	0x11, 0xe, 0x10, 0xa0, 0xc0, 0xa0, 0xc0, 0xa0, 0x10, 0x8, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70,
+	0x10, 0x1, 0x11, 0x70, 0x10, 0xd, 0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x10, 0x60, 0x11, 0x8,
+	0x10, 0x62, 0x90, 0x60, 0x10, 0x1, 0x11, 0x3, 0x12, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90,
+	0x10, 0x8, 0x11, 0x5, 0x25, 0x31, 0x35, 0x21, 0x5, 0x11, 0xe, 0x10, 0xc0, 0xa0, 0xc0, 0xa0,
+	0xc0, 0x10, 0x8, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x10, 0x2, 0x12, 0xd, 0x10, 0xb4, 0x10,
+	0x8, 0x10, 0x64, 0x10, 0x61, 0x11, 0x7, 0x10, 0x61, 0x90, 0x60, 0x90, 0x10, 0x1, 0x12, 0x4,
+	0x11, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x11, 0x7, 0x11, 0x5, 0x25, 0x31, 0x35, 0x21, 0x5,
+	0x11, 0xe, 0x10, 0xa0, 0xc0, 0xa0, 0xc0, 0xa0, 0x10, 0x8, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70,
+	0x10, 0x4, 0x10, 0x3, 0x10, 0x8, 0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x10, 0x62, 0x11, 0x6,
+	0x10, 0x62, 0x90, 0x60, 0x10, 0x1, 0x10, 0x90, 0x11, 0x4, 0x11, 0x90, 0xc0, 0x90, 0xc0, 0x90,
+	0xc0, 0x10, 0x7, 0x11, 0x5, 0x25, 0x31, 0x35, 0x21, 0x5, 0x11, 0xe, 0x10, 0xc0, 0xa0, 0xc0,
+	0xa0, 0xc0, 0x10, 0x8, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x10, 0x7, 0x12, 0x8, 0x10, 0xb4,
+	0x10, 0x8, 0x10, 0x64, 0x10, 0x63, 0x11, 0x5, 0x10, 0x61, 0x90, 0x60, 0x90, 0x10, 0x1, 0x10,
+	0x60, 0x90, 0x12, 0x3, 0x11, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0x10, 0x7, 0x11, 0x5, 0x25, 0x31,
+	0x25, 0x31, 0x5, 0x11, 0xe, 0x10, 0xa0, 0xc0, 0xa0, 0xc0, 0xa0, 0x10, 0x8, 0x10, 0x70, 0xa0,
+	0x70, 0xa0, 0x70, 0x10, 0x5, 0x12, 0x70, 0x10, 0x8, 0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x10,
+	0x64, 0x10, 0x5, 0x10, 0x62, 0x90, 0x60, 0x10, 0x1, 0x10, 0x93, 0x11, 0x3, 0x12, 0xc0, 0x90,
+	0xc0, 0x10, 0x7, 0x11, 0x5, 0x35, 0x21, 0x37, 0x5, 0x11, 0xe, 0x10, 0xc0, 0xa0, 0xc0, 0xa0,
+	0xc0, 0x10, 0x8, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x10, 0x3, 0x12, 0x72, 0x10, 0x8, 0x10,
+	0xb4, 0x10, 0x8, 0x10, 0x64, 0x10, 0x64, 0x11, 0x4, 0x10, 0x61, 0x90, 0x60, 0x90, 0x10, 0x1,
+	0x10, 0x60, 0x93, 0x11, 0x4, 0x11, 0xc0, 0x11, 0x7, 0x11, 0x5, 0x27, 0x27, 0x5, 0x11, 0xe,
+	0x10, 0xa0, 0xc0, 0xa0, 0xc0, 0xa0, 0x10, 0x8, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70, 0x10, 0x1,
+	0x12, 0x74, 0x10, 0x8, 0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x10, 0x65, 0x11, 0x3, 0x10, 0x62,
+	0x90, 0x60, 0x10, 0x1, 0x10, 0x95, 0x11, 0x4, 0x12, 0x8, 0x11, 0x5, 0x37, 0x27, 0x5, 0x11,
+	0xe, 0x10, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0x10, 0x8, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0, 0x13,
+	0x76, 0x10, 0x8, 0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x10, 0x66, 0x11, 0x2, 0x10, 0x61, 0x90,
+	0x60, 0x90, 0x10, 0x1, 0x10, 0x60, 0x95, 0x12, 0x2, 0x12, 0x8, 0x11, 0x5, 0x37, 0x27, 0x5,
+	0x11, 0xe, 0x10, 0xa0, 0xc0, 0xa0, 0xc0, 0xa0, 0x10, 0x8, 0x10, 0x70, 0xa0, 0x70, 0xa0, 0x70,
+	0x11, 0xa0, 0x77, 0x10, 0x8, 0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x10, 0x67, 0x11, 0x1, 0x10,
+	0x62, 0x90, 0x60, 0x10, 0x1, 0x10, 0x98, 0x11, 0x1, 0x11, 0x9, 0x11, 0x5, 0x37, 0x27, 0x5,
+	0x11, 0xe, 0x10, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0x10, 0x8, 0x10, 0xa0, 0x70, 0xa0, 0x70, 0xa0,
+	0x70, 0xa0, 0x78, 0x10, 0x8, 0x10, 0xb4, 0x10, 0x8, 0x10, 0x64, 0x10, 0x68, 0x11, 0x0, 0x10,
+	0x61, 0x90, 0x60, 0x90, 0x10, 0x1, 0x10, 0x60, 0x98, 0x13, 0xa, 0x11, 0x5, 0x37, 0x27, 0x5,
+	0x11, 0xe, 0x16, 0x8, 0x1f, 0x11, 0x8, 0x16, 0x8, 0x1f, 0x11, 0x0, 0x16, 0x1, 0x1c, 0xc,
+	0x11, 0x5, 0x37, 0x27, 0x5, 0x11, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5,
+	0x37, 0x27, 0x5, 0x11, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x37, 0x27,
+	0x5, 0x11, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x37, 0x47, 0x5, 0x11,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x27, 0x47, 0x5, 0x11, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x27, 0x47, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1b,
+	0xd, 0x1a, 0xb, 0x1a, 0xf, 0x9, 0x11, 0x5, 0x27, 0x47, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1c,
+	0xc, 0x1b, 0x9, 0x1b, 0xf, 0x9, 0x11, 0x5, 0x27, 0x47, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1d,
+	0xc, 0x1a, 0x8, 0x1b, 0xf, 0xa, 0x11, 0x5, 0x27, 0x47, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1e,
+	0xc, 0x19, 0x8, 0x1a, 0xf, 0xb, 0x11, 0x5, 0x27, 0x47, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1f,
+	0xc, 0x1a, 0x5, 0x1a, 0xf, 0xc, 0x11, 0x5, 0x27, 0x47, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1f,
+	0x10, 0xc, 0x1a, 0x3, 0x1a, 0xf, 0xd, 0x11, 0x5, 0x27, 0x57, 0x5, 0x11, 0xf, 0x9, 0x1f,
+	0x1f, 0x11, 0xc, 0x1a, 0x1, 0x1a, 0xf, 0xe, 0x11, 0x5, 0x37, 0x57, 0x5, 0x11, 0xf, 0x9,
+	0x1f, 0x1f, 0x12, 0xc, 0x1f, 0x15, 0xf, 0xf, 0x11, 0x5, 0x37, 0x57, 0x5, 0x11, 0xf, 0xc,
+	0x18, 0xb, 0x1a, 0xd, 0x1f, 0x13, 0xf, 0xf, 0x0, 0x11, 0x5, 0x37, 0x57, 0x5, 0x11, 0xf,
+	0xc, 0x18, 0xc, 0x19, 0xd, 0x1f, 0x13, 0xf, 0xf, 0x0, 0x11, 0x5, 0x37, 0x57, 0x5, 0x11,
+	0xf, 0xc, 0x18, 0xd, 0x18, 0xe, 0x1f, 0x11, 0xf, 0xf, 0x1, 0x11, 0x5, 0x37, 0x57, 0x5,
+	0x11, 0xf, 0xc, 0x18, 0xe, 0x17, 0xf, 0x1f, 0xf, 0xf, 0x2, 0x11, 0x5, 0x37, 0x57, 0x5,
+	0x11, 0xf, 0xc, 0x18, 0xe, 0x17, 0xf, 0x0, 0x1d, 0xf, 0xf, 0x3, 0x11, 0x5, 0x37, 0x57,
+	0x5, 0x11, 0xf, 0xc, 0x18, 0xe, 0x17, 0xf, 0x1, 0x1b, 0xf, 0xf, 0x4, 0x11, 0x5, 0x37,
+	0x37, 0x5, 0x11, 0xf, 0xc, 0x18, 0xe, 0x17, 0xf, 0x1, 0x1b, 0xf, 0xf, 0x4, 0x11, 0x5,
+	0x27, 0x37, 0x5, 0x11, 0xf, 0xc, 0x18, 0xe, 0x17, 0xf, 0x0, 0x1d, 0xf, 0xf, 0x3, 0x11,
+	0x5, 0x27, 0x37, 0x5, 0x11, 0xf, 0xc, 0x18, 0xe, 0x17, 0xf, 0x1f, 0xf, 0xf, 0x2, 0x11,
+	0x5, 0x27, 0x37, 0x5, 0x11, 0xf, 0xc, 0x18, 0xd, 0x18, 0xe, 0x1f, 0x11, 0xf, 0xf, 0x1,
+	0x11, 0x5, 0x27, 0x37, 0x5, 0x11, 0xf, 0xc, 0x18, 0xc, 0x19, 0xd, 0x1f, 0x13, 0xf, 0xf,
+	0x0, 0x11, 0x5, 0x27, 0x37, 0x5, 0x11, 0xf, 0xc, 0x18, 0xb, 0x1a, 0xd, 0x1f, 0x13, 0xf,
+	0xf, 0x0, 0x11, 0x5, 0x27, 0x37, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1f, 0x12, 0xc, 0x1f, 0x15,
+	0xf, 0xf, 0x11, 0x5, 0x27, 0x37, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1f, 0x11, 0xc, 0x1a, 0x1,
+	0x1a, 0xf, 0xe, 0x11, 0x5, 0x27, 0x27, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1f, 0x10, 0xc, 0x1a,
+	0x3, 0x1a, 0xf, 0xd, 0x11, 0x5, 0x37, 0x27, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1f, 0xc, 0x1a,
+	0x5, 0x1a, 0x5, 0x14, 0x0, 0x10, 0x2, 0x10, 0xb, 0x11, 0x5, 0x37, 0x27, 0x5, 0x11, 0xf,
+	0x9, 0x1f, 0x1e, 0xc, 0x1a, 0x7, 0x1a, 0x6, 0x10, 0x2, 0x11, 0x0, 0x11, 0xb, 0x11, 0x5,
+	0x37, 0x27, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1d, 0xc, 0x1b, 0x7, 0x1b, 0x5, 0x10, 0x2, 0x10,
+	0x0, 0x10, 0x0, 0x10, 0xb, 0x11, 0x5, 0x37, 0x27, 0x5, 0x11, 0xf, 0x9, 0x1f, 0x1c, 0xc,
+	0x1b, 0x9, 0x1b, 0x4, 0x10, 0x2, 0x10, 0x2, 0x10, 0xb, 0x11, 0x5, 0x37, 0x27, 0x5, 0x11,
+	0xf, 0x9, 0x1f, 0x1b, 0xd, 0x1a, 0xb, 0x1a, 0x4, 0x10, 0x2, 0x10, 0x2, 0x10, 0xb, 0x11,
+	0x5, 0x37, 0x27, 0x5, 0x11, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x37,
+	0x27, 0x5, 0x11, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x37, 0x47, 0x5,
+	0x11, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x11, 0x5, 0x27, 0x47, 0x5, 0x1f, 0x1f,
+	0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x13, 0x5, 0x27, 0x47, 0x5, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x1f, 0x1f, 0x1f, 0x13, 0x5, 0x27, 0x47, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x27, 0x47, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x27, 0x47, 0xf, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x27, 0x47, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x27, 0x47, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x27, 0x57, 0x47, 0x27,
+	0x37, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x27, 0x37, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x8f,
+	0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x27, 0x37, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x8f, 0x8f, 0x8f,
+	0x8f, 0x8f, 0x8f, 0x27, 0x37, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x1f, 0x27, 0x37, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27,
+	0x37, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x37, 0x27,
+	0x37, 0x57, 0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x37, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x37, 0x27, 0x37, 0x37, 0x27, 0x47,
+	0x57, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47, 0x57, 0x1d,
+	0xe7, 0x15, 0x71, 0x12, 0x75, 0x11, 0x71, 0x16, 0x74, 0x11, 0x71, 0x11, 0x71, 0x11, 0x76, 0x10,
+	0x75, 0x1f, 0x10, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47, 0x57, 0x1d, 0xe0, 0xf5, 0xe0, 0x14,
+	0x72, 0x12, 0x71, 0x12, 0x71, 0x10, 0x71, 0x15, 0x71, 0x12, 0x71, 0x10, 0x71, 0x11, 0x71, 0x11,
+	0x71, 0x15, 0x71, 0x12, 0x71, 0x1f, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47, 0x57, 0x1d, 0xe0,
+	0xf5, 0xe0, 0x15, 0x71, 0x12, 0x71, 0x12, 0x71, 0x10, 0x71, 0x15, 0x71, 0x12, 0x71, 0x10, 0x71,
+	0x11, 0x71, 0x11, 0x74, 0x12, 0x71, 0x12, 0x71, 0x1f, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47,
+	0x57, 0x1d, 0xe0, 0xf5, 0xe0, 0x15, 0x71, 0x12, 0x75, 0x11, 0x71, 0x15, 0x76, 0x11, 0x73, 0x12,
+	0x71, 0x15, 0x75, 0x1f, 0x10, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47, 0x57, 0x1d, 0xe0, 0xf5,
+	0xe0, 0x15, 0x71, 0x12, 0x71, 0x15, 0x71, 0x12, 0x71, 0x10, 0x71, 0x12, 0x71, 0x12, 0x71, 0x13,
+	0x71, 0x15, 0x71, 0x12, 0x71, 0x1f, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47, 0x57, 0x1d, 0xe7,
+	0x13, 0x75, 0x10, 0x71, 0x15, 0x76, 0x10, 0x71, 0x12, 0x71, 0x12, 0x71, 0x13, 0x76, 0x10, 0x71,
+	0x12, 0x71, 0x1f, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47, 0x57, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x1f, 0x37, 0x27, 0x47, 0x57, 0x27, 0x37, 0x57, 0x47, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27,
+	0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x37, 0x57, 0x47, 0x27,
+	0x37, 0x57, 0x47, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x1f,
+	0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x1f, 0x1f, 0x1f,
+	0x1f, 0x1f, 0x1f, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x1f, 0x27, 0x37, 0x57, 0x47, 0x47, 0x57, 0x37, 0x27, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x37,
+	0x57, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x37, 0x57, 0x37,
+	0x27, 0x47, 0x57, 0x37, 0x27, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x37, 0x57, 0x37, 0x27, 0x47,
+	0x57, 0x37, 0x27, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x37, 0x57, 0x37, 0x27, 0x47, 0x57, 0x37,
+	0x27, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x37, 0x57, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x1f,
+	0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x37, 0x57, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x1f, 0x1f, 0x1f,
+	0x1f, 0x1f, 0x1f, 0x37, 0x57, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x1f, 0x37, 0x57, 0x37, 0x27, 0x57, 0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x47, 0x27,
+	0x37, 0x57, 0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27,
+	0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x1f,
+	0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x27, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f,
+	0x1f, 0x1f, 0x1f, 0x27, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x1f, 0x27, 0x47, 0x27, 0x37, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37,
+	0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x37,
+	0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47,
+	0x57, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x47,
+	0x57, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37,
+	0x27, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37,
+	0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x37,
+	0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x47,
+	0x57, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x47,
+	0x57, 0x37, 0x27, 0x47, 0x57, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37, 0x27, 0x37,
+	0x27, 0x37, 0x27, 0x47, 0x57, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57, 0x47, 0x27, 0x37, 0x57,
+	0x47, 0x27, 0x37, 0x57, 0x47
 };
+const rle_image_t main_menu = {main_menu_palette, 16, main_menu_rows, main_menu_runs, 4};
 
-unsigned short int tetris_game_screen[144][160] = {
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0x0, 0xfff, 0x0, 0xfff, 0xfff, 0x0, 0x4bd, 0x4bd, 0x4bd, 0x0, 0xfff, 0xfff, 0x0, 0xfff, 0x0, 0xfff, 0xfff, 0x4bd, 0x0, 0x4bd, 0x4bd, 0x4bd, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x0, 0xfff, 0x4bd, 0x4bd, 0x0, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x4bd, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0x4bd, 0x4bd, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x4bd, 0x0, 0xfff, 0x4bd, 0xfff, 0x0, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x0, 0xfff, 0x4bd, 0xfff, 0x0, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0x4bd, 0x4bd, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0x4bd, 0x4bd, 0x4bd, 0xfff, 0x0, 0x4bd, 0x0, 0xfff, 0x0, 0x4bd, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bd, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x0, 0x4bd, 0x0, 0xfff, 0x0, 0x4bd, 0x4bd, 0x4bd, 0x4bd, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0x4bd, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x0, 0x4bd, 0x0, 0x4bd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bd, 0x0, 0x0, 0x0, 0x0, 0xfff, 0x4bd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4bd, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x4bd, 0x4bd, 0x0, 0x4bd, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0x0, 0x4bd, 0xfff, 0x0, 0x0, 0x4bd, 0xfff, 0x4bd, 0x4bd, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0x4bd, 0x0, 0x4bd, 0x0, 0x4bd, 0x4bd, 0x4bd, 0x0, 0x4bd, 0x0, 0x4bd, 0x4bd, 0x4bd, 0x0, 0xfff, 0x0, 0x4bd, 0x4bd, 0x4bd, 0x0, 0x4bd, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0x4bd, 0x0, 0x4bd, 0xfff, 0xfff, 0x0, 0x4bd, 0xfff, 0xfff, 0x4bd, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0x4bd, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0x4bd, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0x4bd, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0x4bd, 0xfff, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0x4bd, 0xfff, 0xfff, 0x4bd, 0x4bd, 0x4bd, 0xfff, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0x4bd, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0xe67, 0xea8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xea8, 0xea8, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xea8, 0xfd8, 0xfd8, 0xea8, 0xfd8, 0xfd8, 0xea8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0xfd8, 0xfd8, 0xea8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0x0, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x0, 0xe67, 0xea8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xea8, 0xea8, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x0, 0xe67, 0xe67, 0xe67, 0x0, 0xea8, 0xe67, 0x0, 0xea8, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0x0, 0xea8, 0xe67, 0x0, 0xea8, 0xe67, 0xe67, 0xe67, 0x0, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0x6ac, 0x6ac, 0x378, 0x378, 0x6ac, 0x6ac, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6ac, 0x6ac, 0x378, 0x378, 0x6ac, 0x6ac, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0x6ac, 0x378, 0x378, 0x378, 0x378, 0x6ac, 0x0, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0x0, 0x6ac, 0x378, 0x378, 0x378, 0x378, 0x6ac, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xe67, 0xea8, 0xe67, 0xe67, 0x0, 0xea8, 0xea8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xea8, 0xea8, 0x0, 0xe67, 0xea8, 0xe67, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xe67, 0xea8, 0xe67, 0x0, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xe67, 0xea8, 0xe67, 0x0, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xe67, 0xea8, 0xe67, 0x0, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xe67, 0xea8, 0xe67, 0x0, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xe67, 0xea8, 0xe67, 0x0, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xe67, 0xea8, 0xe67, 0x0, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xe67, 0xea8, 0xe67, 0x0, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xe67, 0xea8, 0xe67, 0x0, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xfd8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfd8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0, 0xea8, 0xea8, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xea8, 0xea8, 0x0, 0xea8, 0xfd8, 0xea8, 0xe67, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x0, 0xe67, 0xea8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xea8, 0xea8, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x0, 0xea8, 0xfd8, 0xfd8, 0xea8, 0xfd8, 0xfd8, 0xea8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0xea8, 0xfd8, 0xfd8, 0xea8, 0xfd8, 0xfd8, 0xfd8, 0xfd8, 0x0, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x6ac, 0x0}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x0, 0x6ac, 0x6ac, 0x378, 0x378, 0x6ac, 0x6ac, 0x0, 0xe67, 0xea8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xe67, 0xfd8, 0xea8, 0xea8, 0xea8, 0x0, 0x6ac, 0x6ac, 0x378, 0x378, 0x6ac, 0x6ac, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0x6ac, 0x378, 0x378, 0x378, 0x378, 0x6ac, 0x0, 0xe67, 0xe67, 0xe67, 0x0, 0xea8, 0xe67, 0x0, 0xea8, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0xe67, 0x0, 0xea8, 0xe67, 0x0, 0xea8, 0xe67, 0xe67, 0xe67, 0x0, 0x6ac, 0x378, 0x378, 0x378, 0x378, 0x6ac, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xcde, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x6ac, 0x0, 0xfff, 0xfff, 0x231, 0x231, 0x231, 0x231, 0x231, 0x231, 0x475, 0x475, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x6ac, 0x378, 0x0, 0x6ac, 0x6ac, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}, 
-	{0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0x378, 0x0, 0x6ac, 0x378, 0x378, 0x0, 0x6ac, 0x378, 0x475, 0x475, 0x475, 0x475, 0x475, 0x475, 0x231, 0x231, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x352, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x698, 0x352, 0x352}
+// tetris_game_screen: 160x144, 13 colors, 4290 runs; generated by img_to_pixel.py
+const unsigned short int tetris_game_screen_palette[13] = {
+	0xfff, 0x0, 0x352, 0x698, 0x6ac, 0x231, 0x475, 0x378, 0xcde, 0xea8, 0xfd8, 0xe67, 0x4bd
+};
+const unsigned short int tetris_game_screen_rows[144] = {
+	0, 13, 55, 116, 179, 230, 285, 346, 396, 413, 440, 467, 494, 511, 538, 565,
+	594, 608, 649, 691, 736, 766, 798, 831, 860, 885, 924, 963, 1000, 1025, 1064, 1101,
+	1138, 1167, 1206, 1245, 1284, 1313, 1352, 1391, 1432, 1461, 1500, 1539, 1578, 1607, 1646, 1685,
+	1726, 1753, 1788, 1827, 1864, 1889, 1928, 1967, 2006, 2023, 2052, 2084, 2129, 2157, 2202, 2246,
+	2272, 2290, 2318, 2346, 2374, 2392, 2420, 2448, 2478, 2491, 2522, 2561, 2596, 2619, 2658, 2691,
+	2716, 2729, 2752, 2775, 2798, 2811, 2834, 2857, 2882, 2900, 2928, 2956, 2984, 3002, 3030, 3058,
+	3088, 3101, 3134, 3167, 3200, 3223, 3258, 3289, 3314, 3327, 3350, 3373, 3396, 3409, 3432, 3455,
+	3480, 3498, 3526, 3554, 3582, 3600, 3628, 3656, 3686, 3699, 3732, 3767, 3800, 3823, 3860, 3893,
+	3918, 3931, 3954, 3977, 4000, 4013, 4036, 4059, 4084, 4102, 4130, 4158, 4186, 4204, 4232, 4260
+};
+const unsigned char tetris_game_screen_runs[4290] = {
+	0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0xf, 0xf, 0xf, 0x7, 0x25, 0x31, 0x1,
+	0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10,
+	0x4, 0x10, 0x2, 0x10, 0x2, 0x10, 0x2, 0x13, 0x3, 0x10, 0x1, 0x14, 0x0, 0x10, 0x2, 0x10,
+	0x1, 0x12, 0x1, 0x10, 0x2, 0x10, 0x4, 0x25, 0x31, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x0, 0xc0, 0x2, 0x10, 0xc0, 0x1,
+	0x10, 0xc0, 0x0, 0x10, 0x0, 0x10, 0x1, 0x10, 0xc2, 0x10, 0x1, 0x10, 0x0, 0x10, 0x1, 0xc0,
+	0x10, 0xc2, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x10, 0x0, 0xc1, 0x10, 0x0, 0x10, 0xc0, 0x1, 0x10,
+	0xc0, 0x1, 0xc0, 0x0, 0x25, 0x31, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x0, 0xc1, 0x1, 0x11, 0x0, 0x11, 0xc0, 0x10, 0x0,
+	0xc0, 0x0, 0x10, 0x0, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x10, 0x0, 0xc0, 0x0, 0x10, 0x1, 0x10,
+	0xc0, 0x1, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x11, 0x1, 0x10, 0xc0,
+	0x0, 0xc1, 0x0, 0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x0, 0xc2, 0x0, 0x10,
+	0xc0, 0x10, 0x0, 0x10, 0xc0, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x10,
+	0xc0, 0x1, 0x10, 0xc0, 0x0, 0x10, 0xc0, 0x1, 0x14, 0xc0, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x10,
+	0xc0, 0x10, 0x0, 0x10, 0xc3, 0x0, 0x25, 0x31, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf,
+	0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x2, 0xc1, 0x1, 0x10, 0xc0, 0x10, 0xc0, 0x10,
+	0xc0, 0x14, 0xc0, 0x13, 0x0, 0xc0, 0x14, 0xc0, 0x0, 0x10, 0xc0, 0x1, 0x10, 0xc2, 0x10, 0xc0,
+	0x10, 0xc0, 0x1, 0x10, 0xc0, 0x10, 0xc0, 0x0, 0x11, 0xc0, 0x0, 0xc1, 0x0, 0x35, 0x21, 0x70,
+	0x10, 0x41, 0x70, 0x10, 0x41, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41,
+	0x0, 0xc0, 0x2, 0x10, 0xc0, 0x0, 0xc0, 0x10, 0xc0, 0x10, 0xc2, 0x10, 0xc0, 0x10, 0xc2, 0x10,
+	0x0, 0x10, 0xc2, 0x10, 0xc0, 0x0, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x0, 0x12,
+	0x0, 0xc0, 0x10, 0xc0, 0x1, 0x10, 0xc0, 0x1, 0xc0, 0x0, 0x35, 0x21, 0x70, 0x10, 0x40, 0x71,
+	0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x5,
+	0xc0, 0x2, 0xc0, 0x0, 0xc0, 0x2, 0xc0, 0x0, 0xc0, 0x2, 0xc0, 0x0, 0xc0, 0x2, 0xc0, 0x1,
+	0xc0, 0x2, 0xc0, 0x2, 0xc0, 0x1, 0xc2, 0x1, 0xc0, 0x2, 0xc0, 0x3, 0x35, 0x21, 0x17, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0x17, 0x55, 0x67, 0x57, 0x67, 0x57, 0x67, 0x57, 0x61, 0x35, 0x21, 0x1,
+	0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10,
+	0x55, 0x67, 0x57, 0x67, 0x57, 0x67, 0x57, 0x61, 0x35, 0x21, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x55, 0x67, 0x57, 0x67, 0x57,
+	0x67, 0x57, 0x61, 0x35, 0x21, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x55, 0x67, 0x57, 0x67, 0x57, 0x67, 0x57, 0x61, 0x35, 0x21,
+	0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x55, 0x67, 0x57, 0x67, 0x57, 0x67, 0x57, 0x61, 0x35,
+	0x21, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40,
+	0x10, 0x1, 0x55, 0x67, 0x57, 0x67, 0x57, 0x67, 0x57, 0x61, 0x25, 0x31, 0x70, 0x10, 0x41, 0x70,
+	0x10, 0x41, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x65, 0x57, 0x67,
+	0x57, 0x67, 0x57, 0x67, 0x51, 0x25, 0x31, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x65, 0x57, 0x67, 0x57, 0x67, 0x57,
+	0x67, 0x51, 0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x65, 0x51, 0x1f, 0x1f, 0x1f,
+	0x25, 0x31, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10,
+	0x1, 0x40, 0x10, 0x65, 0x51, 0x10, 0x5, 0x10, 0xb0, 0x91, 0xb0, 0xa0, 0x90, 0xb0, 0xa0, 0x9f,
+	0xb0, 0xa0, 0x90, 0xb0, 0xa0, 0x92, 0x10, 0x5, 0x10, 0x25, 0x31, 0x41, 0x70, 0x10, 0x41, 0x70,
+	0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x65, 0x51, 0x10, 0x40,
+	0x3, 0x40, 0x10, 0x90, 0xa1, 0x90, 0xa1, 0x90, 0xaf, 0xa0, 0x90, 0xa1, 0x90, 0xa3, 0x10, 0x40,
+	0x3, 0x40, 0x10, 0x25, 0x31, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x65, 0x51, 0x10, 0x41, 0x1, 0x41, 0x10, 0xb0, 0x91, 0xb0,
+	0xa0, 0x90, 0xb0, 0xa0, 0x9f, 0xb0, 0xa0, 0x90, 0xb0, 0xa0, 0x92, 0x10, 0x41, 0x1, 0x41, 0x10,
+	0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x65, 0x51, 0x10, 0x45, 0x10, 0xb2, 0x10,
+	0x90, 0xb0, 0x10, 0x90, 0xbf, 0x10, 0x90, 0xb0, 0x10, 0x90, 0xb2, 0x10, 0x45, 0x10, 0x25, 0x31,
+	0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10,
+	0x1, 0x65, 0x51, 0x10, 0x41, 0x71, 0x41, 0x1f, 0x1f, 0x11, 0x41, 0x71, 0x41, 0x10, 0x35, 0x21,
+	0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10,
+	0x41, 0x55, 0x61, 0x10, 0x40, 0x73, 0x40, 0x10, 0x9f, 0x9f, 0x10, 0x40, 0x73, 0x40, 0x10, 0x35,
+	0x21, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40,
+	0x71, 0x10, 0x40, 0x70, 0x55, 0x61, 0x17, 0x90, 0xaf, 0xad, 0x90, 0x17, 0x35, 0x21, 0x17, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0x17, 0x55, 0x61, 0x10, 0xb0, 0x90, 0xb1, 0x10, 0x91, 0xf, 0xf, 0x91,
+	0x10, 0xb0, 0x90, 0xb1, 0x10, 0x35, 0x21, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf,
+	0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x55, 0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10,
+	0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35, 0x21, 0x41, 0x70,
+	0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x55,
+	0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0,
+	0x90, 0xb0, 0x10, 0x35, 0x21, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x55, 0x61, 0x10, 0xb0, 0x90, 0xb0, 0x11, 0x90, 0xa0, 0xf,
+	0xf, 0xa0, 0x90, 0x10, 0xb0, 0x90, 0xb0, 0x11, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x17, 0x55, 0x61, 0x10, 0xa2, 0x90, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0xa2, 0x90,
+	0x10, 0x35, 0x21, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10,
+	0x1, 0x40, 0x10, 0x1, 0x55, 0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf,
+	0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x25, 0x31, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x65, 0x51, 0x10, 0xb0, 0x90,
+	0xb0, 0x11, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0xb0, 0x90, 0xb0, 0x11, 0x25, 0x31, 0x70,
+	0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10,
+	0x40, 0x70, 0x65, 0x51, 0x10, 0xa2, 0x90, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0xa2,
+	0x90, 0x10, 0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x65, 0x51, 0x10, 0x90, 0xa0,
+	0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x25,
+	0x31, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1,
+	0x40, 0x10, 0x65, 0x51, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90,
+	0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x25, 0x31, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x65, 0x51, 0x10, 0x90, 0xa0, 0x90, 0xb0,
+	0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x25, 0x31, 0x40,
+	0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10,
+	0x65, 0x51, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90,
+	0xa0, 0x90, 0xb0, 0x10, 0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x65, 0x51, 0x10,
+	0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0,
+	0x10, 0x25, 0x31, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10,
+	0x1, 0x40, 0x10, 0x1, 0x65, 0x51, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf,
+	0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35, 0x21, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x55, 0x61, 0x10, 0x90, 0xa0,
+	0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35,
+	0x21, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40,
+	0x71, 0x10, 0x40, 0x70, 0x55, 0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf,
+	0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x17, 0x55, 0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10,
+	0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35, 0x21, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf,
+	0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x55, 0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10,
+	0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35, 0x21, 0x41, 0x70,
+	0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x55,
+	0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0,
+	0x90, 0xb0, 0x10, 0x35, 0x21, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x55, 0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0,
+	0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf,
+	0xf, 0xf, 0x17, 0x55, 0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0,
+	0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35, 0x21, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x1, 0x55, 0x61, 0x10, 0x90, 0xa0, 0x90,
+	0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x25, 0x31,
+	0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10,
+	0x41, 0x65, 0x51, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10,
+	0x90, 0xa0, 0x90, 0xb0, 0x10, 0x25, 0x31, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x65, 0x51, 0x10, 0x90, 0xa0, 0x90,
+	0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x25, 0x31,
+	0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x65, 0x51, 0x10, 0xb0, 0x90, 0xb0, 0x11, 0x90, 0xa0,
+	0xf, 0xf, 0xa0, 0x90, 0x10, 0xb0, 0x90, 0xb0, 0x11, 0x25, 0x31, 0x1, 0x40, 0x10, 0x1, 0x40,
+	0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x65, 0x51, 0x10, 0xa2,
+	0x90, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0xa2, 0x90, 0x10, 0x25, 0x31, 0x41, 0x70,
+	0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x65,
+	0x51, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0,
+	0x90, 0xb0, 0x10, 0x25, 0x31, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x65, 0x51, 0x10, 0xb0, 0x90, 0xb0, 0x11, 0x90, 0xa0, 0xf,
+	0xf, 0xa0, 0x90, 0x10, 0xb0, 0x90, 0xb0, 0x11, 0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x17, 0x65, 0x51, 0x10, 0xa2, 0x90, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0xa2, 0x90,
+	0x10, 0x25, 0x31, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10,
+	0x1, 0x40, 0x10, 0x1, 0x65, 0x51, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf,
+	0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35, 0x21, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x55, 0x61, 0x10, 0x90, 0xa0,
+	0x90, 0xb0, 0x10, 0x90, 0xa0, 0xf, 0xf, 0xa0, 0x90, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35,
+	0x21, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40,
+	0x71, 0x10, 0x40, 0x70, 0x55, 0x61, 0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x91, 0xf, 0xf, 0x91,
+	0x10, 0x90, 0xa0, 0x90, 0xb0, 0x10, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x55,
+	0x61, 0x17, 0x90, 0xaf, 0xad, 0x90, 0x17, 0x35, 0x21, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x55, 0x61, 0x10, 0x5, 0x10, 0x9f,
+	0x9f, 0x10, 0x5, 0x10, 0x35, 0x21, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x55, 0x61, 0x10, 0x40, 0x3, 0x40, 0x1f, 0x1f, 0x11,
+	0x40, 0x3, 0x40, 0x10, 0x35, 0x21, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x55, 0x61, 0x10, 0x41, 0x1, 0x41, 0x10, 0xb0, 0x91,
+	0xb0, 0xa0, 0x90, 0xb0, 0xa0, 0x9f, 0xb0, 0xa0, 0x90, 0xb0, 0xa0, 0x92, 0x10, 0x41, 0x1, 0x41,
+	0x10, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x55, 0x61, 0x10, 0x45, 0x10, 0x90,
+	0xa1, 0x90, 0xa1, 0x90, 0xaf, 0xa0, 0x90, 0xa1, 0x90, 0xa3, 0x10, 0x45, 0x10, 0x35, 0x21, 0x40,
+	0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x1,
+	0x55, 0x61, 0x10, 0x41, 0x71, 0x41, 0x10, 0xb0, 0x91, 0xb0, 0xa0, 0x90, 0xb0, 0xa0, 0x9f, 0xb0,
+	0xa0, 0x90, 0xb0, 0xa0, 0x92, 0x10, 0x41, 0x71, 0x41, 0x10, 0x25, 0x31, 0x70, 0x10, 0x41, 0x70,
+	0x10, 0x41, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x65, 0x51, 0x10,
+	0x40, 0x73, 0x40, 0x10, 0xb2, 0x10, 0x90, 0xb0, 0x10, 0x90, 0xbf, 0x10, 0x90, 0xb0, 0x10, 0x90,
+	0xb2, 0x10, 0x40, 0x73, 0x40, 0x10, 0x25, 0x31, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x65, 0x51, 0x1f, 0x1f, 0x1f,
+	0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27,
+	0x37, 0x21, 0x25, 0x31, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1,
+	0x40, 0x10, 0x1, 0x40, 0x10, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27, 0x37, 0x21, 0x25, 0x31,
+	0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70,
+	0x10, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27, 0x37, 0x21, 0x25, 0x31, 0x40, 0x71, 0x10, 0x40,
+	0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x65, 0x51, 0x25,
+	0x37, 0x27, 0x37, 0x27, 0x37, 0x21, 0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x65,
+	0x51, 0x25, 0x37, 0x27, 0x37, 0x27, 0x37, 0x21, 0x25, 0x31, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x1, 0x65, 0x51, 0x25, 0x37, 0x27,
+	0x37, 0x27, 0x37, 0x21, 0x35, 0x21, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x55, 0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31,
+	0x35, 0x21, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10,
+	0x40, 0x71, 0x10, 0x40, 0x70, 0x55, 0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21,
+	0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0xf, 0xf, 0xf, 0x35, 0x21, 0x1, 0x40, 0x10,
+	0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x87, 0x1,
+	0x14, 0x2, 0x14, 0x2, 0x14, 0x1, 0x15, 0x1, 0x16, 0x7, 0x35, 0x21, 0x41, 0x70, 0x10, 0x41,
+	0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x87, 0x0, 0x11,
+	0x2, 0x11, 0x0, 0x11, 0x2, 0x11, 0x0, 0x11, 0x2, 0x11, 0x0, 0x11, 0x2, 0x11, 0x0, 0x11,
+	0xc, 0x35, 0x21, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x40, 0x71,
+	0x10, 0x40, 0x71, 0x10, 0x87, 0x1, 0x12, 0x3, 0x11, 0x5, 0x11, 0x2, 0x11, 0x0, 0x11, 0x2,
+	0x11, 0x0, 0x14, 0x9, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0x4, 0x11,
+	0x1, 0x11, 0x5, 0x11, 0x2, 0x11, 0x0, 0x15, 0x1, 0x11, 0xc, 0x35, 0x21, 0x40, 0x10, 0x1,
+	0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x1, 0x87, 0x0,
+	0x11, 0x1, 0x12, 0x0, 0x11, 0x2, 0x11, 0x0, 0x11, 0x2, 0x11, 0x0, 0x11, 0x2, 0x11, 0x0,
+	0x11, 0xc, 0x25, 0x31, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70,
+	0x10, 0x41, 0x70, 0x10, 0x41, 0x87, 0x1, 0x14, 0x2, 0x14, 0x2, 0x14, 0x1, 0x11, 0x2, 0x11,
+	0x0, 0x16, 0x7, 0x25, 0x31, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x17, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x1, 0x40, 0x10, 0x1, 0x40,
+	0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x87, 0xf, 0xf, 0xf,
+	0x25, 0x31, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10,
+	0x41, 0x70, 0x10, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31,
+	0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x40, 0x10, 0x1,
+	0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x1, 0x87, 0xf,
+	0xf, 0xf, 0x35, 0x21, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70,
+	0x10, 0x41, 0x70, 0x10, 0x41, 0x87, 0xf, 0xf, 0xf, 0x35, 0x21, 0x70, 0x10, 0x40, 0x71, 0x10,
+	0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x87, 0xf,
+	0xf, 0xf, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x55, 0x61, 0x35, 0x27, 0x37,
+	0x27, 0x37, 0x27, 0x31, 0x35, 0x21, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x55, 0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31,
+	0x35, 0x21, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10,
+	0x41, 0x70, 0x10, 0x55, 0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21, 0x40, 0x71,
+	0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x55,
+	0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x17, 0x55, 0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21, 0x40, 0x10, 0x1, 0x40,
+	0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x1, 0x55, 0x61, 0x35,
+	0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x25, 0x31, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27,
+	0x37, 0x21, 0x25, 0x31, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27, 0x37, 0x21,
+	0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x1,
+	0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10,
+	0x87, 0x0, 0x11, 0x5, 0x16, 0x0, 0x11, 0x2, 0x11, 0x0, 0x16, 0x0, 0x11, 0xc, 0x25, 0x31,
+	0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70,
+	0x10, 0x87, 0x0, 0x11, 0x5, 0x11, 0x5, 0x11, 0x2, 0x11, 0x0, 0x11, 0x5, 0x11, 0xc, 0x25,
+	0x31, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x40, 0x71, 0x10, 0x40,
+	0x71, 0x10, 0x87, 0x0, 0x11, 0x5, 0x14, 0x3, 0x11, 0x0, 0x11, 0x1, 0x14, 0x2, 0x11, 0xc,
+	0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0x0, 0x11, 0x5, 0x11, 0x6, 0x11,
+	0x0, 0x11, 0x1, 0x11, 0x5, 0x11, 0xc, 0x25, 0x31, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x1, 0x87, 0x0, 0x11, 0x2, 0x11, 0x0,
+	0x11, 0x7, 0x12, 0x2, 0x11, 0x5, 0x11, 0x2, 0x11, 0x7, 0x35, 0x21, 0x70, 0x10, 0x41, 0x70,
+	0x10, 0x41, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x87, 0x0, 0x16,
+	0x0, 0x16, 0x2, 0x12, 0x2, 0x16, 0x0, 0x16, 0x7, 0x35, 0x21, 0x70, 0x10, 0x40, 0x71, 0x10,
+	0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x87, 0xf,
+	0xf, 0xf, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0xf, 0xf, 0xf, 0x35,
+	0x21, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1,
+	0x40, 0x10, 0x87, 0xf, 0xf, 0xf, 0x35, 0x21, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x87, 0xf, 0xf, 0xf, 0x35, 0x21, 0x40,
+	0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10,
+	0x87, 0xf, 0xf, 0xf, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0xf, 0xf,
+	0xf, 0x35, 0x21, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10,
+	0x1, 0x40, 0x10, 0x1, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x87, 0xf, 0xf, 0xf, 0x25,
+	0x31, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40,
+	0x71, 0x10, 0x40, 0x70, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x17, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27, 0x37, 0x21, 0x25, 0x31, 0x1, 0x40, 0x10, 0x1,
+	0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x65, 0x51, 0x25,
+	0x37, 0x27, 0x37, 0x27, 0x37, 0x21, 0x25, 0x31, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27,
+	0x37, 0x21, 0x25, 0x31, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x40,
+	0x71, 0x10, 0x40, 0x71, 0x10, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27, 0x37, 0x21, 0x25, 0x31,
+	0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27, 0x37, 0x21,
+	0x25, 0x31, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1,
+	0x40, 0x10, 0x1, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27, 0x37, 0x21, 0x35, 0x21, 0x70, 0x10,
+	0x41, 0x70, 0x10, 0x41, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x55,
+	0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40,
+	0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x55, 0x61, 0x35,
+	0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87,
+	0xf, 0xf, 0xf, 0x35, 0x21, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x87, 0x0, 0x11, 0x6, 0x13, 0x2, 0x11, 0x2, 0x11, 0x0,
+	0x16, 0x1, 0x14, 0x8, 0x35, 0x21, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0x87, 0x0, 0x11, 0x7, 0x11, 0x3, 0x12, 0x1, 0x11,
+	0x0, 0x11, 0x5, 0x11, 0x2, 0x11, 0x7, 0x35, 0x21, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf,
+	0xf, 0xf, 0xf, 0xf, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x87, 0x0, 0x11, 0x7, 0x11, 0x3,
+	0x13, 0x0, 0x11, 0x0, 0x14, 0x3, 0x12, 0xa, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf,
+	0x17, 0x87, 0x0, 0x11, 0x7, 0x11, 0x3, 0x11, 0x0, 0x13, 0x0, 0x11, 0x9, 0x11, 0x8, 0x35,
+	0x21, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40,
+	0x10, 0x1, 0x87, 0x0, 0x11, 0x2, 0x11, 0x2, 0x11, 0x3, 0x11, 0x1, 0x12, 0x0, 0x11, 0x5,
+	0x11, 0x1, 0x12, 0x7, 0x25, 0x31, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x87, 0x0, 0x16, 0x1, 0x13, 0x2, 0x11, 0x2, 0x11,
+	0x0, 0x16, 0x1, 0x14, 0x8, 0x25, 0x31, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31,
+	0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x1, 0x40, 0x10,
+	0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x87, 0xf,
+	0xf, 0xf, 0x25, 0x31, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41,
+	0x70, 0x10, 0x41, 0x70, 0x10, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x40, 0x71, 0x10, 0x40, 0x71,
+	0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0x87, 0xf, 0xf, 0xf,
+	0x25, 0x31, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x87, 0xf, 0xf, 0xf, 0x25, 0x31, 0x40,
+	0x10, 0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x1,
+	0x87, 0xf, 0xf, 0xf, 0x35, 0x21, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0xf, 0xf, 0xf, 0xf,
+	0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x87, 0xf, 0xf, 0xf, 0x35, 0x21, 0x70, 0x10, 0x40,
+	0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70,
+	0x87, 0xf, 0xf, 0xf, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf, 0xf, 0xf, 0x17, 0x55, 0x61, 0x35,
+	0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0xf, 0xf,
+	0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x55, 0x61, 0x35, 0x27, 0x37, 0x27, 0x37,
+	0x27, 0x31, 0x35, 0x21, 0x41, 0x70, 0x10, 0x41, 0x70, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x41,
+	0x70, 0x10, 0x41, 0x70, 0x10, 0x55, 0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21,
+	0x40, 0x71, 0x10, 0x40, 0x71, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x40, 0x71, 0x10, 0x40, 0x71,
+	0x10, 0x55, 0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21, 0x17, 0xf, 0xf, 0xf,
+	0xf, 0xf, 0x17, 0x55, 0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x35, 0x21, 0x40, 0x10,
+	0x1, 0x40, 0x10, 0xf, 0xf, 0xf, 0xf, 0xf, 0x1, 0x40, 0x10, 0x1, 0x40, 0x10, 0x1, 0x55,
+	0x61, 0x35, 0x27, 0x37, 0x27, 0x37, 0x27, 0x31, 0x25, 0x31, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41,
+	0xf, 0xf, 0xf, 0xf, 0xf, 0x70, 0x10, 0x41, 0x70, 0x10, 0x41, 0x65, 0x51, 0x25, 0x37, 0x27,
+	0x37, 0x27, 0x37, 0x21, 0x25, 0x31, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0xf, 0xf, 0xf,
+	0xf, 0xf, 0x70, 0x10, 0x40, 0x71, 0x10, 0x40, 0x70, 0x65, 0x51, 0x25, 0x37, 0x27, 0x37, 0x27,
+	0x37, 0x21
 };
+const rle_image_t tetris_game_screen = {tetris_game_screen_palette, 13, tetris_game_screen_rows, tetris_game_screen_runs, 4};
 
 unsigned int animation_section_cols[8] = {46, 47, 48, 49, 50, 51, 52, 53};
 unsigned int animation_section_rows[6] = {97, 98, 99, 100, 101, 102};
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,55 @@
+/**
+* Brief:
+* auto repeat of held keys; see key_repeat.h
+**/
+#include "key_repeat.h"
+
+
+/**
+ * @brief starts the auto repeat of a key when its press event comes in
+ * 
+ * @param repeat  auto repeat of the key
+ * @param now     mtime of the press
+ * @return true if the key was not already held; the press itself acts once
+ */
+bool key_repeat_press(key_repeat_t *repeat, unsigned int now) {
+    if (repeat->held) {
+        return false;
+    }
+
+    repeat->held = true;
+    repeat->next_time = now + repeat->delay;
+    return true;
+}
+
+/**
+ * @brief steps the auto repeat of a key once per frame. A press the key event
+ * has not reported yet is taken from keys_held, so each press acts only once
+ * 
+ * @param repeat     auto repeat of the key
+ * @param keys_held  KEY_STATE_REG read this frame
+ * @param now        mtime of this frame
+ * @return true if the key acts this frame
+ */
+bool key_repeat_step(key_repeat_t *repeat, unsigned int keys_held, unsigned int now) {
+    if (!(keys_held & repeat->key_state)) {
+        repeat->held = false;
+        return false;
+    }
+
+    if (!repeat->held) {
+        return key_repeat_press(repeat, now);
+    }
+
+    // the signed difference survives mtime wrapping around
+    if ((int)(now - repeat->next_time) < 0) {
+        return false;
+    }
+
+    repeat->next_time += repeat->rate;
+    // after a long stall (line clear animation) restart the rate instead of replaying the missed repeats
+    if ((int)(now - repeat->next_time) >= 0) {
+        repeat->next_time = now + repeat->rate;
+    }
+    return true;
+}
@@ -0,0 +1,26 @@
+/**
+* Brief:
+* delayed auto shift and auto repeat of held keys. A key acts once when it goes down, again after a delay if it is
+* still held, then at a fixed rate until it is let go. The game loop feeds it the press events of the keyboard
+* interrupt (key_repeat_press) and the KEY_STATE_REG bitmap once per frame (key_repeat_step). Like game_core, nothing
+* in here touches a register: times are mtime ticks the caller reads, so the same code runs on a PC (see
+* applications/host, key_repeat_test)
+**/
+#ifndef __KEY_REPEAT__
+#define __KEY_REPEAT__
+
+#include <stdbool.h>
+
+// auto repeat of one held key; times are mtime ticks
+typedef struct key_repeat {
+    unsigned int key_state;  // KEY_STATE_* bit of the key
+    unsigned int delay;      // from the press to the first repeat
+    unsigned int rate;       // between repeats; must not be 0
+    bool held;
+    unsigned int next_time;  // mtime of the next repeat
+} key_repeat_t;
+
+bool key_repeat_press(key_repeat_t *repeat, unsigned int now);
+bool key_repeat_step(key_repeat_t *repeat, unsigned int keys_held, unsigned int now);
+
+#endif
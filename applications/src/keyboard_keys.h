@@ -6,7 +6,27 @@
 #define S_KEY 0x1B
 #define D_KEY 0x23
 #define ENTER_KEY 0x5A
-#define RELEASE_KEY 0xF000
-#define KEY_RELEASE_MASK 0xFF00
+#define SPACE_KEY 0x29
+
+// key events decoded by the keyboard RTL; low 8 bits = scancode of the key
+#define KEY_BREAK 0x100     // key was released
+#define KEY_EXTENDED 0x200  // key is an extended key (arrows, right ctrl, ...)
+#define KEY_REPEAT 0x400    // typematic make of a key that is already held down
+
+// bits of KEY_STATE_REG; bit = 1 while the key is held down
+#define KEY_STATE_W      (1 << 0)
+#define KEY_STATE_A      (1 << 1)
+#define KEY_STATE_S      (1 << 2)
+#define KEY_STATE_D      (1 << 3)
+#define KEY_STATE_ENTER  (1 << 4)
+#define KEY_STATE_SPACE  (1 << 5)
+#define KEY_STATE_ESCAPE (1 << 6)
+#define KEY_STATE_P      (1 << 7)
+#define KEY_STATE_UP     (1 << 8)
+#define KEY_STATE_LEFT   (1 << 9)
+#define KEY_STATE_DOWN   (1 << 10)
+#define KEY_STATE_RIGHT  (1 << 11)
+#define KEY_STATE_Q      (1 << 12)
+#define KEY_STATE_E      (1 << 13)
 
 #endif
\ No newline at end of file
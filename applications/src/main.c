@@ -16,58 +16,125 @@
 *   tetris (4 lines cleared): 1200 points*(level + 1)
 *   level advances for every 10 lines cleared
 **/
-#include <math.h>
 #include <stdbool.h>
-#include <stdlib.h>
+#include <stdint.h>
+#ifndef HOST_EMULATOR
 #include <sys/_intsup.h>  // This an the one below it is for catapult
 #include <sys/_types.h>   // If not on catapult, should comment <sys/_intsup.h> and <sys/_types.h>
+#endif
 #include "colors.h"
+#include "game_core.h"
 #include "img.h"
+#include "key_repeat.h"
 #include "keyboard_keys.h"
-
-// These are needed for VScode for something
-#ifndef M_PI
-    #define M_PI 3.14159265358979323846
+#include "replay.h"
+#ifdef REPLAY_BENCH
+#include "replay_bench.h" // replay_bench_seed, replay_bench_bytes, replay_bench_length; written by tetris_replay -c
 #endif
-#ifndef M_PI_2
-    #define M_PI_2 1.57079632679489661923
+#ifdef CORE_BENCH
+#include "core_bench.h"
 #endif
 
 /** registers for VGA/HW graphics **/
 // RAM_REG: used to position to a pixel in the 160x144 pixel screen; bits 19:10 = row and bits 9:0 = col
 #define RAM_REG 0x80001500
-// RGB_REG: used to set the current pixel position to an RGB color; bits 11:8 = red, bits 7:4 = green, bits 3:0 = blue
+// RGB_REG: used to set the current pixel position to a color; bits 3:0 = palette index, see PALETTE_REG
 #define RGB_REG 0x80001504 
 // next_shape_REG: used to update the portion of screen displaying the incoming tetris shape; 
 // write values 0-6 to chose a tetris shape; 
 // 0 = I shape; 1 = J shape, 2 = L shape, 3 = O shape, 4 = Sshape, 5 = Tshape, 6 = Z shape
 #define NEXT_SHAPE_REG 0x80001508
 // SCORE_REG: used to update the number value in the 'score' section of the screen
-// IMPORTANT: must use 'update_number' function to update the value on screen
-// because the number needs to be formated a certain way
+// IMPORTANT: value must be packed BCD (one decimal digit per 4 bits, 6 digits) because the RTL draws each nibble as a digit
+// keep the counter in BCD with 'bcd_add' so it can be written to the register as is
 #define SCORE_REG 0x8000150C
 // LEVEL_REG: used to update the number value in the 'level' section of the screen
-// IMPORTANT: must use 'update_number' function to update the value on screen
-// because the number needs to be formated a certain way
+// IMPORTANT: value must be packed BCD (one decimal digit per 4 bits, 6 digits) because the RTL draws each nibble as a digit
+// keep the counter in BCD with 'bcd_add' so it can be written to the register as is
 #define LEVEL_REG 0x80001510
 // LINES_REG: used to update the number value in the 'lines' section of the screen
-// IMPORTANT: must use 'update_number' function to update the value on screen
-// because the number needs to be formated a certain way
+// IMPORTANT: value must be packed BCD (one decimal digit per 4 bits, 6 digits) because the RTL draws each nibble as a digit
+// keep the counter in BCD with 'bcd_add' so it can be written to the register as is
 #define LINES_REG 0x80001514
-
-/** registers for timer ***/
-// TIMER_REG: starts or stops a timer in milliseconds
-// bit 31 = timer is not done bit; bit = 1 = NOT DONE; bit = 0 = DONE
-// bit 30 = start timer; bit = 1 = timer started from beginning; bit = 0 = timer is running
-// bit 29:0 = milisecond delay value; if value = 1 = 1 millisecond timer
-#define TIMER_REG 0x80001518
-#define CHECK_TIMER 0x8000151C
+// TILE_REG: sets one block of the play area tile map; the RTL expands each tile into an 8x8 block while scanning the screen
+// bit 31 = 1 = play area comes from the tile map (tile map mode); bit 31 = 0 = play area comes from game_ram (main menu)
+// bits 28:24 = virtual row (0-17); bits 20:16 = virtual col (0-9)
+// bits 3:0 = tile id; 0 = empty (white), 1-7 = i-z shape block, 8 = gray
+#define TILE_REG 0x80001524
+// STREAM_REG: streams pixels into the 160x144 pixel screen; every RGB_REG write stores a pixel and moves to the next col,
+// wrapping to the start col of the next row after 'row width' pixels. A RAM_REG write ends the stream
+// bit 31 = 1 = streaming on; bits 27:20 = row width; bits 19:10 = start row; bits 9:0 = start col
+#define STREAM_REG 0x80001528
+// ROW_SHIFT_REG: moves every row of the play area tile map above a band of cleared rows down by the size of the band
+// and fills the top rows with empty tiles; writes to the vga registers are held off until the shift is done
+// bits 28:24 = bottom row of the band (0-17); bits 2:0 = number of rows in the band
+#define ROW_SHIFT_REG 0x8000152C
+// PALETTE_REG: sets one of the 16 colors game_ram pixels index into; each page has its own palette and the write goes
+// to the palette of the page PAGE_REG draws into, so the screen changes color as soon as it is written if that page is shown
+// bits 27:24 = palette entry; bits 11:8 = red, bits 7:4 = green, bits 3:0 = blue
+#define PALETTE_REG 0x80001530
+// FLASH_ROWS_REG: rows of the play area drawn gray whatever tiles they hold; bits 17:0 = one bit per virtual row
+#define FLASH_ROWS_REG 0x80001534
+// PAGE_REG: game_ram has two pages; RAM_REG/RGB_REG and PALETTE_REG writes go to the draw page while the
+// monitor shows the display page, which only changes in the vertical blank so a frame never shows half of each
+// bit 4 = display page from the next vertical blank; bit 0 = draw page
+// read: bit 31 = 1 = the display page has not flipped yet; bit 8 = page on screen
+#define PAGE_REG 0x80001538
+// FRAME_REG: vertical blanks of the monitor, 60 per second; the vertical blank interrupt (VGA_IRQ_ID) stays on while one is pending
+// read: bit 31 = vertical blank pending; bit 30 = in the vertical blank now; bit 24 = interrupt on; bits 23:0 = vertical blanks since reset
+// write: bit 31 = 1 = clears the pending vertical blank; bit 0 = interrupt on
+#define FRAME_REG 0x8000153C
+// PIECE_REG: the falling shape, drawn by the RTL over the play area tile map; moving or rotating it is a single write
+// and it only goes into the tile map once it locks. The monitor shows a new value from the next vertical blank
+// bit 31 = 1 = shape shown; bits 29:24 = row of the 4x4 box of the shape, bits 20:16 = col of the box (both two's complement,
+// the box may stick out of the board); bits 9:8 = orientation; bits 2:0 = shape, see tetris_shapes_t
+// bit 30 = 1 = ghost shown: the outline of the same shape in the same col, at the row of its box in bits 15:10 (two's complement);
+// drawn on empty tiles only
+#define PIECE_REG 0x80001518
+
+/** registers for time ***/
+// MTIME_REG: bits 31:0 of the system controller mtime counter; counts up once every core clock (50 MHz)
+#define MTIME_REG 0x80001020
 
 /** regisers for keyboard input **/
-// KEYBOARD_REG: read register to get recent keyboard key that was pressed. 
-// the 8 least significant bits determine the key that was pressed
-// the 8 bits to key pressed mapping is found here: ECE540_FINAL_PROJECT/backups/keyboard/IMPORTANT_NOTE/IMPORTANT_NOTE.jpg
-#define KEYBOARD_REG 0x80001700 
+// 0x80001700 (last 4 bytes received) and 0x80001704 (every byte received, with valid and lost bits) are debug
+// registers of PS2Receiver; the game only reads the decoded KEY_STATE_REG and KEY_EVENT_REG
+// KEY_STATE_REG: keys held down, decoded in RTL; one bit per game key, see KEY_STATE_* in keyboard_keys.h
+#define KEY_STATE_REG 0x80001708
+// KEY_EVENT_REG: oldest key press or release, decoded in RTL; reading it removes the event from a 16 deep FIFO.
+// The keyboard interrupt stays on while the FIFO is not empty
+// bit 12 = events were lost because the FIFO was full; bit 11 = valid; bits 10:0 = key event, see KEY_BREAK in keyboard_keys.h
+#define KEY_EVENT_REG 0x8000170C
+#define KEY_EVENT_VALID 0x00000800
+#define KEY_EVENT_MASK  0x000007FF
+
+/** registers for interrupts **/
+// VeeR programmable interrupt controller (PIC); source ids match extintsrc_req in veerwolf_core.v
+#define PIC_BASE 0xF00C0000
+#define PIC_MEIPL(id)     (PIC_BASE + 0x0000 + ((id) << 2)) // priority of each source
+#define PIC_MEIE(id)      (PIC_BASE + 0x2000 + ((id) << 2)) // enable of each source
+#define PIC_MPICCFG       (PIC_BASE + 0x3000)               // priority order
+#define PIC_MEIGWCTRL(id) (PIC_BASE + 0x4000 + ((id) << 2)) // gateway; bit 1 = edge triggered, bit 0 = active low
+#define PIC_MEIGWCLR(id)  (PIC_BASE + 0x5000 + ((id) << 2)) // clears an edge triggered gateway
+#define UART_IRQ_ID 1
+#define PS2_IRQ_ID 5
+#define VGA_IRQ_ID 6
+#define MAX_IRQ_PRIORITY 15
+
+// control and status registers used to take interrupts
+#define MSTATUS  0x300
+#define MIE      0x304
+#define MTVEC    0x305
+#define MEIPT    0xBC9  // PIC priority threshold
+#define MEICPCT  0xBCA  // write to capture the id of the highest priority pending interrupt in MEIHAP
+#define MEICIDPL 0xBCB  // priority of the claimed interrupt
+#define MEICURPL 0xBCC  // current priority level
+#define MEIHAP   0xFC8  // bits 9:2 = claimed interrupt id
+#define MCYCLE   0xB00  // core clocks, low word; read by the CORE_BENCH build
+#define MCAUSE   0x342  // bit 31 = 1 = interrupt; bit 31 = 0 = exception, bits 30:0 = exception code
+#define MCAUSE_INTERRUPT 0x80000000
+#define MSTATUS_MIE 0x00000008 // machine interrupts on
+#define MIE_MEIE    0x00000800 // machine external (PIC) interrupts on
 
 /**  registers for audio output **/
 // AUDIO_REG: used to turn on or off the tetris theme
@@ -75,6 +142,23 @@
 // There are other audio files in the RTL
 #define AUDIO_REG 0x80001800
 
+/** registers for the UART (uart16550 in veerwolf_core.v); 8-bit registers, one per word **/
+// UART_THR_REG: write a character into the 16 deep transmit FIFO; divisor latch low byte while LCR bit 7 is set
+// UART_IER_REG: interrupt enable; bit 1 = transmit FIFO empty (THRE); divisor latch high byte while LCR bit 7 is set
+// UART_LCR_REG: line control; bits 1:0 = 3 for 8 data bits, bit 7 = divisor latch access
+// The THRE interrupt is set when the transmit FIFO goes empty, or is turned on with it empty, and is cleared by a
+// write to UART_THR_REG or by turning it off
+#define UART_THR_REG 0x80002000
+#define UART_IER_REG 0x80002004
+#define UART_LCR_REG 0x8000200C
+#define UART_DLL_REG UART_THR_REG
+#define UART_DLM_REG UART_IER_REG
+#define UART_IER_THRE 0x02
+#define UART_LCR_8N1  0x03
+#define UART_LCR_DLAB 0x80
+#define UART_FIFO_DEPTH 16
+#define UART_BAUD_RATE 115200
+
 /** defines for screen constant **/
 #define SCREEN_WIDTH  160 // the entire screen is 160 pixels wide
 #define SCREEN_HEIGHT 144 // the entire screen is 144 pixels tall
@@ -88,32 +172,50 @@
 #define GAME_SCREEN_COL_MAX 96  // horizontal dir: game screen ends at pixel 96; screen is 10 blocks wide (1 block = 8x8 pixel; 8pixels*10blocks + 16pixels for background = 96 pixels)
 
 /** mask values **/
-#define RGB_COLOR_MASK       0x00000FFF // lower 16 bits are used to write to the RGB register
+#define RGB_COLOR_MASK       0x00000FFF // lower 12 bits are used to write a color to the palette register
+#define PALETTE_ENTRY_POSITION 24       // bits 27:24 of PALETTE_REG are the palette entry
 #define ROW_POSITION_MASK    0x000FFC00 // bits 19:10 are used to set the row position on screen
 #define COL_POSITION_MASK    0x000003FF // bits 9:0 are used to set the col position on screen
 #define KEY_PRESSED_MASK     0x000000FF // lower 8 bits determine which key was pressed
-#define DONE_BIT_TIMER_MASK  0x80000000
-#define STOP_BIT_TIMER_MASK  0xC0000000
-#define START_BIT_TIMER_MASK 0x40000000
-
-/** game board boundaries **/
-#define GAME_BOARD_X_MIN 0
-#define GAME_BOARD_X_MAX 10
-#define GAME_BOARD_Y_MIN 0
-#define GAME_BOARD_Y_MAX 18
-#define PIXEL_WILL_BE_FREED 99    // used in collision functions, space in game_board will be unoccupied after a move/rotate
-#define PIXEL_OCCUPIED 1
+#define BLOCK_ROW_POSITION   24         // bits 28:24 of TILE_REG and ROW_SHIFT_REG are the virtual row
+#define BLOCK_COL_POSITION   16         // bits 20:16 of TILE_REG are the virtual col
+#define TILE_MAP_ON          0x80000000 // bit 31 of TILE_REG turns on tile map mode
+#define PIECE_ON             0x80000000 // bit 31 of PIECE_REG shows the falling shape
+#define PIECE_ROW_MASK       0x3F       // PIECE_REG box row, 6 bits at BLOCK_ROW_POSITION
+#define PIECE_COL_MASK       0x1F       // PIECE_REG box col, 5 bits at BLOCK_COL_POSITION
+#define PIECE_ORIENTATION_POSITION 8    // bits 9:8 of PIECE_REG are the orientation
+#define GHOST_ON             0x40000000 // bit 30 of PIECE_REG shows the ghost shape
+#define GHOST_ROW_POSITION   10         // bits 15:10 of PIECE_REG are the ghost box row, PIECE_ROW_MASK wide
+#define STREAM_ON            0x80000000 // bit 31 of STREAM_REG turns on streaming
+#define STREAM_WIDTH_POSITION 20        // bits 27:20 of STREAM_REG are the row width
+#define DISPLAY_PAGE_POSITION 4         // bit 4 of PAGE_REG is the display page; bit 0 is the draw page
+#define FLIP_PENDING         0x80000000 // bit 31 of PAGE_REG reads 1 until the display page has flipped
+#define VBLANK_PENDING       0x80000000 // bit 31 of FRAME_REG; write 1 to clear it
+#define FRAME_IRQ_ON         0x00000001 // bit 0 of FRAME_REG turns on the vertical blank interrupt
+#define FRAME_COUNT_MASK     0x00FFFFFF // bits 23:0 of FRAME_REG count vertical blanks
+#define EMPTY_TILE 0
+#define GRAY_TILE  8
 
 /** other **/
 #define ROW_POSITION 10 // the row pits are 10 bits to the left; use this to shift left 10
-#define NUM_OF_TETRIS_SHAPES 7  // total numbers of tetris shapes 
-#define BLOCKS_PER_SHAPE 4
 #define BLOCK_DIMENSION 8 // 8x8 block
-#define PI_HALF M_PI_2
-#define DELAY_INTERVAL 700000 // 10_000 milliseconds (10 seconds)
 #define MSB 0x80000000
-#define INPUT_DELAY 100000
-#define TIMEOUT_DELAY 90000
+#define KEY_RING_SIZE 32 // power of 2 so the ring indexes can wrap with a mask
+#define UART_RING_SIZE 1024 // characters waiting for the UART; power of 2 like KEY_RING_SIZE
+#define UART_LINE_CHARS 96  // room send_record waits for in the UART ring before each line
+#define CORE_BENCH_ROUNDS 100 // core_bench rounds per comparison in the CORE_BENCH build
+#define CLOCK_FREQUENCY 50000000 // core clock; mtime counts at this rate
+#define FRAME_RATE 60
+#define TICKS_PER_FRAME (CLOCK_FREQUENCY / FRAME_RATE)
+#define DAS_TICKS (16 * TICKS_PER_FRAME)       // delayed auto shift; left/right held this long start repeating
+#define ARR_TICKS (6 * TICKS_PER_FRAME)        // auto repeat rate; ticks between moves once left/right repeat
+#define SOFT_DROP_TICKS (3 * TICKS_PER_FRAME)  // ticks between drops while down is held
+#define MENU_BLINK_FRAMES 15 // the menu cursor is shown and hidden for this many frames each
+#define FLASH_FRAMES 4       // cleared lines are drawn gray and back for this many frames each
+#define GAME_OVER_FRAMES 60  // game over board stays up this long before the main menu
+#define HALT_BLINK_TICKS (30 * TICKS_PER_FRAME) // the play area of exception_halt() blinks at 1 Hz
+#define ALL_PLAY_ROWS 0x3FFFF // FLASH_ROWS_REG bits of all 18 virtual rows
+#define REPLAY_LINE_BYTES 32 // record bytes per line of hex sent out of the UART
 #define MUSIC_MAIN_THEME 1
 #define MUSIC_GAME_OVER 4
 
@@ -121,86 +223,92 @@
 
 #define DEBUG 0
 /** enums, struct, others **/
-typedef struct tetris_shape_obj tetris_shape_obj_t;
-typedef void (*method) (tetris_shape_obj_t *); 
-
-typedef enum tetris_shapes {
-    i_shape,
-    j_shape,
-    l_shape,
-    o_shape,
-    s_shape,
-    t_shape,
-    z_shape
-} tetris_shapes_t;
-
-typedef enum move_dir {
-    left,
-    right,
-    down
-} move_dir_t;
-
-typedef struct vertex {
-    unsigned short int x;
-    unsigned short int y;
-} vertex_t;
-
-typedef struct tetris_shape_obj {
-    tetris_shapes_t shape;
-    vertex_t blocks[BLOCKS_PER_SHAPE]; // 4 blocks for each shape; always top left point of each block
-    vertex_t pivot_point;
-    bool is_not_locked;
-    unsigned int lines_moved;
-    method get_vertices;
-    method rotate;
-    method *move;
-} tetris_shape_obj_t;
-
-typedef struct virtual_board {
-    unsigned int occupied;
-    unsigned int color; 
-} virtual_board_t;
-
-virtual_board_t game_board[GAME_BOARD_Y_MAX][GAME_BOARD_X_MAX] = {0};
+// shadow of the colors in the play area tile map (the falling shape is drawn over it from PIECE_REG); lets update_block
+// skip cells that would not change
+unsigned short int screen_colors[GAME_BOARD_Y_MAX][GAME_BOARD_X_MAX];
+
+// key events from the keyboard interrupt to the game loop; single producer (keyboard_isr) and single
+// consumer (pop_key_event), so each index is written by only one side and no lock is needed
+volatile unsigned short int key_ring[KEY_RING_SIZE];
+volatile unsigned int key_ring_head = 0; // next free slot; written only by keyboard_isr()
+volatile unsigned int key_ring_tail = 0; // oldest event; written only by pop_key_event()
+volatile unsigned int key_event_time = 0; // mtime of the last keyboard interrupt; seeds the shapes of the next game
+
+// characters from uart_send_char to the UART interrupt; single producer and single consumer like the key ring.
+// uart_isr refills the transmit FIFO each time it goes empty and turns its interrupt off once the ring is empty
+volatile char uart_ring[UART_RING_SIZE];
+volatile unsigned int uart_ring_head = 0;   // next free slot; written only by uart_send_char()
+volatile unsigned int uart_ring_tail = 0;   // oldest character; written only by uart_isr()
+volatile bool uart_sending = false;         // the THRE interrupt is on; set by uart_send_char(), cleared by uart_isr()
+volatile unsigned int uart_dropped = 0;     // characters uart_send_char() dropped because the ring was full
+
+// every game is recorded and sent out of the UART once it is over; see replay.h
+replay_record_t game_record;
+
+// game_ram page on screen; the other one is drawn by compose_page()
+unsigned int display_page = 0;
+
+// display frames counted by vblank_isr(); the game loop runs once per frame
+volatile unsigned int display_frame = 0;
+unsigned int vblank_count = 0;        // FRAME_REG count at the last vertical blank interrupt
+unsigned int dropped_frames = 0;      // display frames the game loop was too slow to run in
+unsigned int busiest_frame_ticks = 0; // longest game loop frame in mtime ticks, from the vertical blank to the frame drawn
 
 /** function declarations **/
+#ifdef HOST_EMULATOR
+// Linux build (applications/host); registers are an in-process model of the peripherals
+#include "mmio_model.h"
+#else
 #define READ_GPIO(dir) (*(volatile unsigned *)dir)
 #define WRITE_GPIO(dir, value) { (*(volatile unsigned *)dir) = (value); }
-void delay(unsigned int milliseconds);
+#define CSR_NAME(csr) #csr
+#define CSR_STRING(csr) CSR_NAME(csr)
+#define READ_CSR(csr, value) __asm__ volatile ("csrr %0, " CSR_STRING(csr) : "=r"(value))
+#define WRITE_CSR(csr, value) __asm__ volatile ("csrw " CSR_STRING(csr) ", %0" : : "r"(value))
+#define SET_CSR(csr, mask) __asm__ volatile ("csrs " CSR_STRING(csr) ", %0" : : "r"(mask))
+#define CLEAR_CSR(csr, mask) __asm__ volatile ("csrc " CSR_STRING(csr) ", %0" : : "r"(mask))
+#define WAIT_FOR_INTERRUPT() __asm__ volatile ("wfi")
+#define INTERRUPT_HANDLER __attribute__((interrupt, aligned(4)))
+#endif
 void main_menu_gui();
+void draw_menu_cursor(bool visible);
 void draw_tetris_game_background();
-void update_number(int reg, unsigned int number);
+void stream_image(const rle_image_t *image);
+void compose_page();
+void present_page();
+unsigned int image_color_index(const rle_image_t *image, int row, int col);
 void draw_block(int virtual_row, int virtual_col, int color);
-void spawn_block(tetris_shape_obj_t *tetris_obj);
+void update_block(int virtual_row, int virtual_col, int color);
+void draw_piece(game_state_t *game);
 void clear_screen_play();
-unsigned short int get_new_shape();
-bool collision_movement(int movement_direction, tetris_shape_obj_t *current_shape);
-bool collision_rotation(unsigned int rotation_x[BLOCKS_PER_SHAPE], unsigned int rotation_y[BLOCKS_PER_SHAPE], tetris_shape_obj_t *current_shape);
-void line_clear(unsigned int *lines);
+void draw_game_events(game_state_t *game, unsigned int events);
+void line_clear_animation(game_state_t *game);
+void shift_rows_down(int bottom_row, int row_count);
 void stop_drawing();
-void update_game_speed(unsigned int *input_delay, unsigned int *timeout_delay, unsigned int level);
-
-// functions for tetris objects
-void init_tetris_obj(tetris_shape_obj_t *current_shape, tetris_shapes_t shape);
-
-// initialize vertices for tetris shapes
-void shape_vertices(tetris_shape_obj_t *current_shape);
-
-// rotate functions for tetris shapes
-void rotate_shape(tetris_shape_obj_t *current_shape);
-
-// move functions for tetris shapes
-void move_left (tetris_shape_obj_t *current_shape);
-void move_right(tetris_shape_obj_t *current_shape);
-void move_down (tetris_shape_obj_t *current_shape);
+void init_uart();
+void init_interrupts();
+void trap_handler();
+void exception_halt(unsigned int cause);
+void keyboard_isr();
+void vblank_isr();
+void uart_isr();
+void sleep_until_interrupt(unsigned int frame, bool wake_on_keys);
+void wait_frames(unsigned int frames);
+bool pop_key_event(unsigned short int *key_event);
+bool key_event_pending(unsigned short int key);
+void send_record(const replay_record_t *record, const game_state_t *game);
+void uart_send_string(const char *text);
+void uart_send_hex(unsigned int value, int digits);
+void uart_send_char(char c);
+void uart_wait_for_room(unsigned int chars);
+void replay_benchmark();
+#ifdef CORE_BENCH
+void core_benchmark();
+void send_core_bench(const char *name, const core_bench_result_t *result);
+unsigned int read_mcycle();
+#endif
 
 /** hash tables **/
-void (*move_functions[3]) (tetris_shape_obj_t *) = {
-    move_left, 
-    move_right, 
-    move_down
-};
-
 int shape_color[NUM_OF_TETRIS_SHAPES] = {
     I_SHAPE_COLOR,
     J_SHAPE_COLOR,
@@ -212,1043 +320,986 @@ int shape_color[NUM_OF_TETRIS_SHAPES] = {
 };
 
 int main (void) {
+    init_uart();
+    init_interrupts();
+
+#ifdef REPLAY_BENCH
+    replay_benchmark();
+#endif
+#ifdef CORE_BENCH
+    core_benchmark();
+#endif
     
     while (true) {
-        unsigned int screen_position = 0;
-        unsigned int rgb_color = 0;
-        unsigned int new_shape = 0;
-        unsigned int next_shape = 0;
-        unsigned int score = 0;
-        unsigned int level = 0;
-        unsigned int lines = 0;
-        unsigned int input_delay = INPUT_DELAY;
-        unsigned int timeout_delay = TIMEOUT_DELAY;
-        unsigned int current_time = 0;
-        int key_pressed = 0;
-        int key_released = 0;
-        bool playing_game = true;
-        bool moved_down = false;
-        tetris_shape_obj_t current_shape;
-        unsigned int seed = rand();
-
-        srand(seed);
+        game_state_t game;
+        unsigned int events = 0;
+        unsigned int input = 0;
+        unsigned short int key_event = 0;
+        unsigned int frame = 0;
+        unsigned int frame_time = 0;
+        unsigned int keys_held = 0;
+        key_repeat_t left_repeat = {KEY_STATE_A, DAS_TICKS, ARR_TICKS, false, 0};
+        key_repeat_t right_repeat = {KEY_STATE_D, DAS_TICKS, ARR_TICKS, false, 0};
+        key_repeat_t down_repeat = {KEY_STATE_S, SOFT_DROP_TICKS, SOFT_DROP_TICKS, false, 0};
+        bool shape_locked = false;
+        unsigned int locked_events = 0; // events of a key step that locked the shape, drawn after the vertical blank
+        unsigned int seed = 0;
+        unsigned int game_frame = 0; // game loop frames since game_init; the clock of the game record
+
+        // the shapes are seeded from the time the player took to press enter, in core clocks; the keyboard interrupt
+        // takes mtime when the key comes in, the menu only looks for it every MENU_BLINK_FRAMES
         main_menu_gui();
+        seed = key_event_time;
         draw_tetris_game_background();
         clear_screen_play();
 
-        // initialize score, level, line values
-        update_number(LINES_REG, lines);
-        update_number(LEVEL_REG, level);
-        update_number(SCORE_REG, score);
-
-        // get new shape
-        new_shape = get_new_shape();
-        init_tetris_obj(&current_shape, new_shape);
-
-        // update incoming shape
-        next_shape = get_new_shape();
-        WRITE_GPIO(NEXT_SHAPE_REG, next_shape);
+        // deal the first shape; score, level and lines are kept in packed BCD, see SCORE_REG
+        game_init(&game, seed);
+        replay_record_start(&game_record, seed);
+        WRITE_GPIO(LINES_REG, game.lines);
+        WRITE_GPIO(LEVEL_REG, game.level);
+        WRITE_GPIO(SCORE_REG, game.score);
+        draw_game_events(&game, GAME_EVENT_SPAWNED);
         stop_drawing();
         
         // start music    
         WRITE_GPIO(AUDIO_REG, MUSIC_MAIN_THEME);
 
-        while (playing_game) {
-            while (current_shape.is_not_locked) {
-                current_time = 0;
-
-                // while timer is not done
-                while (current_time != timeout_delay) {
-                    key_released = READ_GPIO(KEYBOARD_REG) & KEY_RELEASE_MASK;
-
-                    if (key_released != RELEASE_KEY) {
-                        delay(1000);
-                        key_pressed = READ_GPIO(KEYBOARD_REG) & KEY_PRESSED_MASK;
-                    
-                        switch (key_pressed) {
-                            // rotate
-                            case W_KEY:
-                                current_shape.rotate(&current_shape);
-                                break;
-                            
-                            // left
-                            case A_KEY:
-                                current_shape.move[left](&current_shape);
-                                break;
-                            
-                            // down
-                            case S_KEY:
-                                current_shape.move[down](&current_shape);
-                                score += 1;
-                                moved_down = true;
-                                break;
-                            
-                            // right
-                            case D_KEY:
-                                current_shape.move[right](&current_shape);
-                                break;
-                        }
+        frame = display_frame;
+        while (!game.game_over) {
+            shape_locked = false;
+
+            // until the next vertical blank; the core sleeps between the keyboard and vertical blank interrupts
+            while (display_frame == frame) {
+                // handle every key the keyboard interrupt queued since the last pass; keys pressed after the
+                // shape locks are left for the next shape. Releases and typematic repeats are skipped,
+                // holding a key is handled once per frame below
+                while (!shape_locked && pop_key_event(&key_event)) {
+                    input = 0;
+                    switch (key_event) {
+                        // rotate
+                        case W_KEY:
+                            input = GAME_INPUT_ROTATE;
+                            break;
+                        
+                        // left
+                        case A_KEY:
+                            if (key_repeat_press(&left_repeat, READ_GPIO(MTIME_REG))) {
+                                input = GAME_INPUT_LEFT;
+                            }
+                            break;
+                        
+                        // down
+                        case S_KEY:
+                            if (key_repeat_press(&down_repeat, READ_GPIO(MTIME_REG))) {
+                                input = GAME_INPUT_SOFT_DROP;
+                            }
+                            break;
+                        
+                        // right
+                        case D_KEY:
+                            if (key_repeat_press(&right_repeat, READ_GPIO(MTIME_REG))) {
+                                input = GAME_INPUT_RIGHT;
+                            }
+                            break;
+
+                        // hard drop; one press locks the shape where the ghost shows it
+                        case SPACE_KEY:
+                            input = GAME_INPUT_HARD_DROP;
+                            break;
+                    }
 
-                        delay(input_delay);
+                    if (input != 0) {
+                        events = game_step(&game, input);
+                        replay_record_step(&game_record, game_frame, input, &game, events);
+                        shape_locked = (events & GAME_EVENT_LOCKED) != 0;
+
+                        // PIECE_REG is only taken at the vertical blank, TILE_REG at once: the overlay goes off
+                        // now and the locked shape goes into the tile map after the blank starts, so no frame
+                        // shows the shape twice (a hard drop) or not at all
+                        if (shape_locked) {
+                            WRITE_GPIO(PIECE_REG, 0);
+                            locked_events = events;
+                        }
+                        else {
+                            draw_game_events(&game, events);
+                        }
                     }
+                }
 
-                    current_time++;
+                sleep_until_interrupt(frame, !shape_locked);
+            }
+
+            // frames are display frames; the ones the loop was too slow for are dropped, not made up
+            dropped_frames += display_frame - frame - 1;
+            frame = display_frame;
+            frame_time = READ_GPIO(MTIME_REG);
+
+            if (shape_locked) {
+                draw_game_events(&game, locked_events);
+            }
+
+            // one load per frame gets every key held down
+            keys_held = READ_GPIO(KEY_STATE_REG);
+
+            // skipped if a key press already locked the shape this frame
+            if (!shape_locked) {
+                input = GAME_INPUT_FRAME;
+
+                // auto shift while left/right are held
+                if (key_repeat_step(&left_repeat, keys_held, frame_time)) {
+                    input |= GAME_INPUT_LEFT;
+                }
+                if (key_repeat_step(&right_repeat, keys_held, frame_time)) {
+                    input |= GAME_INPUT_RIGHT;
                 }
 
-                // if player does not move down before time out then move them down
-                if (!moved_down) {
-                    current_shape.move[down](&current_shape);
-                } else {
-                    moved_down = false;
+                // soft drop while down is held, otherwise game_step lets gravity pull the shape down
+                if (key_repeat_step(&down_repeat, keys_held, frame_time)) {
+                    input |= GAME_INPUT_SOFT_DROP;
                 }
 
-                // update level and lines on screen
-                level = lines / 10;
-                update_number(LEVEL_REG, level);
-                update_number(SCORE_REG, score);
+                events = game_step(&game, input);
+                replay_record_step(&game_record, game_frame, input, &game, events);
+                draw_game_events(&game, events);
+                shape_locked = (events & GAME_EVENT_LOCKED) != 0;
             }
+            game_frame++;
 
-            // if new shape spawns and it collides with another shape then its Game Over.
-            if(!current_shape.is_not_locked && current_shape.lines_moved == 0) {
-                playing_game = false;
+            // the line clear animation stalls the game; the next shape starts counting frames once it is drawn
+            if (shape_locked) {
+                frame = display_frame;
             }
-            
-            // update line
-            line_clear(&lines);
-            update_number(LINES_REG, lines);
-
-            // update new shape
-            new_shape = next_shape;
-            init_tetris_obj(&current_shape, new_shape);
+            else {
+                unsigned int frame_ticks = READ_GPIO(MTIME_REG) - frame_time;
 
-            // update incoming shape
-            next_shape = get_new_shape();
-            WRITE_GPIO(NEXT_SHAPE_REG, next_shape);
-
-            // update speed
-            update_game_speed(&input_delay, &timeout_delay, level);
+                if (frame_ticks > busiest_frame_ticks) {
+                    busiest_frame_ticks = frame_ticks;
+                }
+            }
         }
 
         // game over music
         WRITE_GPIO(AUDIO_REG, MUSIC_GAME_OVER);
-        delay(DELAY_INTERVAL);
+        send_record(&game_record, &game);
+        wait_frames(GAME_OVER_FRAMES);
     }
 
     return 0;
 }
 
 
-/**
- * @brief used to delay
- * 
- * @param length 
- */
-void delay(unsigned int milliseconds) {
-    while (milliseconds > 0) {
-        milliseconds--;
-    }
-}
-
-
 /**
  * @brief draws main menu and waits until user hits 'enter' key from keyboard before starting game
  * there is a red box on screen that acts as the curosr for game play. This cursor will blink on and off.
  * 
  */
 void main_menu_gui() {
-    unsigned int screen_position = 0;
-    unsigned int rgb_color = 0;
-    unsigned int animation_speed = 500;
-    unsigned int animation_row_length = sizeof(animation_section_rows) / sizeof(animation_section_rows[0]);
-    unsigned int animation_col_length = sizeof(animation_section_cols) / sizeof(animation_section_cols[0]);
-    unsigned int animation_row = 0;
-    unsigned int animation_col = 0;
-    int key_pressed = 0;
-    int key_released = 0;
+    // the menu covers the play area so turn off tile map mode
+    WRITE_GPIO(TILE_REG, 0);
     
-    // main menu gui; draw entire screen only once
-    for (int row = 0; row < SCREEN_HEIGHT; row++) {
-        screen_position = (screen_position & COL_POSITION_MASK) + (row << ROW_POSITION);
-        for (int col = 0; col < SCREEN_WIDTH; col++) {
-            screen_position = (screen_position & ROW_POSITION_MASK) + col;
-            rgb_color = main_menu[row][col];
-
-            WRITE_GPIO(RAM_REG, screen_position);
-            WRITE_GPIO(RGB_REG, rgb_color);
-        }
-    }
-    delay(DELAY_INTERVAL);
+    // main menu gui; draw entire screen only once off screen, streaming one RGB_REG write per pixel (RTL sections off)
+    compose_page();
+    WRITE_GPIO(RAM_REG, 0);
+    WRITE_GPIO(STREAM_REG, STREAM_ON + (SCREEN_WIDTH << STREAM_WIDTH_POSITION));
+    stream_image(&main_menu);
+    WRITE_GPIO(STREAM_REG, 0);
+    present_page();
+    wait_frames(MENU_BLINK_FRAMES);
 
-    // uncomment loop if your keyboard works
     while (true) {
-        key_pressed = READ_GPIO(KEYBOARD_REG) & KEY_PRESSED_MASK;
-        delay(DELAY_INTERVAL);
-        if (key_pressed == ENTER_KEY) {
+        wait_frames(MENU_BLINK_FRAMES);
+        if (key_event_pending(ENTER_KEY)) {
             // bit 31 enables the RTL code to update the right side of game screen automatically
             WRITE_GPIO(RAM_REG, (1 << 31));
             return;
         }
 
         // DELETE GUI cursor from display
-        rgb_color = WHITE;
-        WRITE_GPIO(RGB_REG, rgb_color);
-        
-        // loop through sections of screen that will blink (GUI cursor)
-        for (int i = 0; i < animation_row_length; i++) {
-            animation_row = animation_section_rows[i];
-            screen_position = (screen_position & COL_POSITION_MASK) + (animation_row << ROW_POSITION);
-            for (int j = 0; j < animation_col_length; j++) {
-                animation_col = animation_section_cols[j];
-                screen_position = (screen_position & ROW_POSITION_MASK) + animation_col;
-
-                WRITE_GPIO(RAM_REG, screen_position);
-            }
-        }
+        draw_menu_cursor(false);
 
-        key_pressed = READ_GPIO(KEYBOARD_REG) & KEY_PRESSED_MASK;
-        delay(DELAY_INTERVAL);
-        if (key_pressed == ENTER_KEY) {
+        wait_frames(MENU_BLINK_FRAMES);
+        if (key_event_pending(ENTER_KEY)) {
             // bit 31 enables the RTL code to update the right side of game screen automatically
             WRITE_GPIO(RAM_REG, (1 << 31));
             return;
         }
         
         // DRAW cursor on display
-        // loop through sections of screen that will blink (GUI cursor)
-        for (int i = 0; i < animation_row_length; i++) {
-            animation_row = animation_section_rows[i];
-            screen_position = (screen_position & COL_POSITION_MASK) + (animation_row << ROW_POSITION);
-            for (int j = 0; j < animation_col_length; j++) {
-                animation_col = animation_section_cols[j];
-                screen_position = (screen_position & ROW_POSITION_MASK) + animation_col;
-                rgb_color = main_menu[animation_row][animation_col];
-
-                WRITE_GPIO(RAM_REG, screen_position);
-                WRITE_GPIO(RGB_REG, rgb_color);
-            }
-        }
+        draw_menu_cursor(true);
     }
-
-    stop_drawing();
 }
 
 
 /**
- * @brief draws the tetris game screen
+ * @brief draws (main menu colors) or deletes (white) the blinking GUI cursor of the main menu.
+ * The colors of the cursor are used nowhere else on the menu (img_to_pixel.py --keep), so the cursor blinks
+ * by rewriting their palette entries instead of its pixels
+ *
+ * @param visible
  */
-void draw_tetris_game_background() {
-    unsigned int screen_position = 0;
-    unsigned int rgb_color = 0;
-
-    // draw only once
-    for (int row = 0; row < SCREEN_HEIGHT; row++) {
-        screen_position = (screen_position & COL_POSITION_MASK) + (row << ROW_POSITION);
-        for (int col = 0; col < SCREEN_WIDTH; col++) {
-            screen_position = (screen_position & ROW_POSITION_MASK) + col;
-            rgb_color = tetris_game_screen[row][col];
-
-            WRITE_GPIO(RAM_REG, screen_position | MSB);
-            WRITE_GPIO(RGB_REG, rgb_color);
+void draw_menu_cursor(bool visible) {
+    unsigned int animation_row_length = sizeof(animation_section_rows) / sizeof(animation_section_rows[0]);
+    unsigned int animation_col_length = sizeof(animation_section_cols) / sizeof(animation_section_cols[0]);
+    unsigned int written_entries = 0; // one bit per palette entry already written
+    unsigned int color_index = 0;
+
+    // loop through sections of screen that will blink (GUI cursor)
+    for (unsigned int i = 0; i < animation_row_length; i++) {
+        for (unsigned int j = 0; j < animation_col_length; j++) {
+            color_index = image_color_index(&main_menu, animation_section_rows[i], animation_section_cols[j]);
+            if (written_entries & (1 << color_index)) {
+                continue;
+            }
+
+            written_entries |= 1 << color_index;
+            WRITE_GPIO(PALETTE_REG, (color_index << PALETTE_ENTRY_POSITION) + (visible ? main_menu.palette[color_index] : WHITE));
         }
     }
-
-    stop_drawing();
 }
 
 
 /**
- * @brief used to format the given number so that the RTL hardware can update the numbers on screen correctly
- * @example input = 123; format sent to register needs to be: 0x123 thus each digit from the input is left shifted four bits
- * 
- * @param reg    either: score, level, or line register to update on screen
- * @param number the numer to display on screen
+ * @brief loads the palette of an image, then decodes the image run by run straight into RGB_REG, one write
+ * per pixel, from the top left pixel to the bottom right one. The caller sets up STREAM_REG
+ *
+ * @param image
  */
-void update_number(int reg, unsigned int number) {
-    unsigned short digits[6] = {0};
-    unsigned int new_number_format = 0;
+void stream_image(const rle_image_t *image) {
+    unsigned int run_mask = (1 << image->run_bits) - 1;
+    unsigned int run = 0;
 
-    // get each digits from number starting at the ones digit place and ending at the 100 thousand place
-    for (int i = 0; i < 6; i++) {
-        digits[i] = (number / ((int) pow( (double) 10, (double) i)) ) % 10;
+    // image palette indexes are the palette entries of the screen
+    for (unsigned int i = 0; i < image->palette_size; i++) {
+        WRITE_GPIO(PALETTE_REG, (i << PALETTE_ENTRY_POSITION) + image->palette[i]);
     }
 
-    new_number_format = ((digits[5] << 20) + (digits[4] << 16) + (digits[3] << 12) + (digits[2] << 8) + (digits[1] << 4) + (digits[0]));
-    WRITE_GPIO((volatile unsigned int *) reg, new_number_format);
+    for (int pixel = 0, i = 0; pixel < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+        run = image->runs[i];
+        for (int length = (run & run_mask) + 1; length > 0; length--, pixel++) {
+            WRITE_GPIO(RGB_REG, run >> image->run_bits);
+        }
+    }
 }
 
 /**
- * @brief decreases the time the player has to press a keyboard key
- * 
- * @param input_delay 
- * @param timeout_delay 
- * @param level 
+ * @brief waits for the last flip to land, then draws into the page that is not on screen, palette included,
+ * so a whole screen can be composed without the monitor showing it half done
  */
-void update_game_speed(unsigned int *input_delay, unsigned int *timeout_delay, unsigned int level) {
-    if ( (1 <= level) && (level < 2) ) {
-        *input_delay = INPUT_DELAY - 1000;
-        *timeout_delay = TIMEOUT_DELAY - 1000; 
-    }
-    else if ( (2 <= level) && (level < 4) ){
-        *input_delay = INPUT_DELAY - 5000;
-        *timeout_delay = TIMEOUT_DELAY - 5000; 
-    }
-    else if ( (4 <= level) && (level < 8) ){
-        *input_delay = INPUT_DELAY - 10000;
-        *timeout_delay = TIMEOUT_DELAY - 10000; 
+void compose_page() {
+    while (READ_GPIO(PAGE_REG) & FLIP_PENDING) {
+        // the page about to be drawn is still on screen
     }
+
+    WRITE_GPIO(PAGE_REG, (display_page << DISPLAY_PAGE_POSITION) + (display_page ^ 1));
 }
 
 /**
- * @brief Get the next shape object
- * 
- * @return unsigned short int; 0-6 where 0 = i shape ... 6 = z shape
+ * @brief shows the page compose_page() drew from the next vertical blank on and keeps drawing into it, so
+ * later updates such as the menu cursor blink show up right away
  */
-unsigned short int get_new_shape() {
-    unsigned short int next_shape = rand() % NUM_OF_TETRIS_SHAPES;
-    return next_shape;
+void present_page() {
+    display_page ^= 1;
+    WRITE_GPIO(PAGE_REG, (display_page << DISPLAY_PAGE_POSITION) + display_page);
 }
 
 /**
- * @brief initializes the tetris shape object
- * 
- * @param current_shape i - z shape
- * @param shape         new shape to adjust object to
+ * @brief looks up a single pixel of an image; walks the runs of its row only
+ *
+ * @param image
+ * @param row
+ * @param col
+ * @return palette index of the pixel
  */
-void init_tetris_obj(tetris_shape_obj_t *current_shape, tetris_shapes_t shape) {
-    current_shape->shape = shape;
-    current_shape->is_not_locked = true;
-    current_shape->get_vertices = shape_vertices;
-    current_shape->rotate = rotate_shape;
-    current_shape->move = move_functions;
-    current_shape->lines_moved = 0;
+unsigned int image_color_index(const rle_image_t *image, int row, int col) {
+    unsigned int run_mask = (1 << image->run_bits) - 1;
+    unsigned int run = 0;
+    int i = image->rows[row];
+
+    // skip whole runs until col falls inside one
+    for (run = image->runs[i]; col > (int) (run & run_mask); run = image->runs[++i]) {
+        col -= (run & run_mask) + 1;
+    }
 
-    current_shape->get_vertices(current_shape);
-    spawn_block(current_shape);
-}   
+    return run >> image->run_bits;
+}
 
 
 /**
- * @brief Each shape has four blocks. This function will set the top left corner (x, y) point 
- * for each block in shape
- * 
- * @param current_shape 
+ * @brief draws the tetris game screen
  */
-void shape_vertices(tetris_shape_obj_t *current_shape) {
-
-    switch (current_shape->shape) {
-        case i_shape:
-            current_shape->blocks[0].y = 1*8; current_shape->blocks[0].x = 3*8;
-            current_shape->blocks[1].y = 1*8; current_shape->blocks[1].x = 4*8;
-            current_shape->blocks[2].y = 1*8; current_shape->blocks[2].x = 5*8;
-            current_shape->blocks[3].y = 1*8; current_shape->blocks[3].x = 6*8;
-            current_shape->pivot_point.x = current_shape->blocks[2].x; 
-            current_shape->pivot_point.y = current_shape->blocks[2].y + 8;
-            break;
-        case j_shape:
-            current_shape->blocks[0].y = 1*8; current_shape->blocks[0].x = 3*8;
-            current_shape->blocks[1].y = 1*8; current_shape->blocks[1].x = 4*8;
-            current_shape->blocks[2].y = 1*8; current_shape->blocks[2].x = 5*8;
-            current_shape->blocks[3].y = 2*8; current_shape->blocks[3].x = 5*8;
-            current_shape->pivot_point.x = current_shape->blocks[1].x + 4; 
-            current_shape->pivot_point.y = current_shape->blocks[1].y + 4;
-            break;
-        case l_shape:
-            current_shape->blocks[0].y = 1*8; current_shape->blocks[0].x = 3*8;
-            current_shape->blocks[1].y = 1*8; current_shape->blocks[1].x = 4*8;
-            current_shape->blocks[2].y = 1*8; current_shape->blocks[2].x = 5*8;
-            current_shape->blocks[3].y = 2*8; current_shape->blocks[3].x = 3*8;
-            current_shape->pivot_point.x = current_shape->blocks[1].x + 4; 
-            current_shape->pivot_point.y = current_shape->blocks[1].y + 4;
-            break;
-        case o_shape:
-            current_shape->blocks[0].y = 0*8; current_shape->blocks[0].x = 3*8;
-            current_shape->blocks[1].y = 0*8; current_shape->blocks[1].x = 4*8;
-            current_shape->blocks[2].y = 1*8; current_shape->blocks[2].x = 3*8;
-            current_shape->blocks[3].y = 1*8; current_shape->blocks[3].x = 4*8;
-            current_shape->pivot_point.x = current_shape->blocks[1].x; 
-            current_shape->pivot_point.y = current_shape->blocks[1].y + 8;
-            break;
-        case s_shape:
-            current_shape->blocks[0].y = 1*8; current_shape->blocks[0].x = 4*8;
-            current_shape->blocks[1].y = 1*8; current_shape->blocks[1].x = 5*8;
-            current_shape->blocks[2].y = 2*8; current_shape->blocks[2].x = 3*8;
-            current_shape->blocks[3].y = 2*8; current_shape->blocks[3].x = 4*8;
-            current_shape->pivot_point.x = current_shape->blocks[0].x + 4; 
-            current_shape->pivot_point.y = current_shape->blocks[0].y + 4;
-            break;
-        case t_shape:
-            current_shape->blocks[0].y = 1*8; current_shape->blocks[0].x = 3*8;
-            current_shape->blocks[1].y = 1*8; current_shape->blocks[1].x = 4*8;
-            current_shape->blocks[2].y = 1*8; current_shape->blocks[2].x = 5*8;
-            current_shape->blocks[3].y = 2*8; current_shape->blocks[3].x = 4*8;
-            current_shape->pivot_point.x = current_shape->blocks[1].x + 4; 
-            current_shape->pivot_point.y = current_shape->blocks[1].y + 4;
-            break;
-        case z_shape:
-            current_shape->blocks[0].y = 1*8; current_shape->blocks[0].x = 3*8;
-            current_shape->blocks[1].y = 1*8; current_shape->blocks[1].x = 4*8;
-            current_shape->blocks[2].y = 2*8; current_shape->blocks[2].x = 4*8;
-            current_shape->blocks[3].y = 2*8; current_shape->blocks[3].x = 5*8;
-            current_shape->pivot_point.x = current_shape->blocks[1].x + 4; 
-            current_shape->pivot_point.y = current_shape->blocks[1].y + 4;   
-            break;
-    }
+void draw_tetris_game_background() {
+    // draw only once off screen, streaming one RGB_REG write per pixel (RTL sections on)
+    compose_page();
+    WRITE_GPIO(RAM_REG, MSB);
+    WRITE_GPIO(STREAM_REG, STREAM_ON + (SCREEN_WIDTH << STREAM_WIDTH_POSITION));
+    stream_image(&tetris_game_screen);
+
+    stop_drawing();
+    present_page();
 }
 
 
 /**
- * @brief rotates all the points of the shape CLOCK-WISE by 90 degrees
+ * @brief shows the falling shape where it is now, and its ghost where it would land, with a single write to PIECE_REG;
+ * the RTL draws both over the tile map, so nothing has to be erased where they were
  * 
- * @param current_shape 
+ * @param game 
  */
-void rotate_shape(tetris_shape_obj_t *current_shape) {
-    if (current_shape->shape == o_shape)
-        return;
+void draw_piece(game_state_t *game) {
+    tetris_shape_obj_t *current_shape = &game->current_shape;
+
+    WRITE_GPIO(PIECE_REG, PIECE_ON + GHOST_ON +
+               ((current_shape->origin.y & PIECE_ROW_MASK) << BLOCK_ROW_POSITION) +
+               ((current_shape->origin.x & PIECE_COL_MASK) << BLOCK_COL_POSITION) +
+               ((landing_row(game) & PIECE_ROW_MASK) << GHOST_ROW_POSITION) +
+               (current_shape->orientation << PIECE_ORIENTATION_POSITION) + current_shape->shape);
+}
 
-    // for storing new position
-    unsigned int new_x[BLOCKS_PER_SHAPE] = {0};
-    unsigned int new_y[BLOCKS_PER_SHAPE] = {0};
-    int x0, y0; // for centering the current x and y around the origin
-    
+/**
+ * @brief moves the position register off screen so no unwanted pixel get displayed on screen. 
+ * value in register persist so we need to explicitly move the register off screen.
+ * 
+ */
+void stop_drawing() {
+    int position = 0;
 
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        // center points around origin; rotation only works if its centered around origin
-        x0 = current_shape->blocks[i].x - current_shape->pivot_point.x;
-        y0 = current_shape->blocks[i].y - current_shape->pivot_point.y;
+    // move pixel position offscreen so that vga does not write to unwanted pixel
+    position = (1 << 31) + ((8*5) << ROW_POSITION) + (8*16);
+    WRITE_GPIO(RAM_REG, position);
+}
 
-        // calculate new point and un-center it around origin
-        // new x is now at top right corner so need to subtract block width (move to top left)
-        new_x[i] = (int) round(((x0 * cos(PI_HALF) - y0 * sin(PI_HALF)) + current_shape->pivot_point.x) - BLOCK_DIMENSION);
-        new_y[i] = (int) round((x0 * sin(PI_HALF) + y0 * cos(PI_HALF)) + current_shape->pivot_point.y);
-    }
+/** draw_block
+ * @brief
+ * draws an 8x8 block on the screen with a single write to the play area tile map (TILE_REG)
+ * picking the color will draw or erase(white) a tetrimino
+ *
+ * @param virtual_row
+ * @param virtual_col
+ * These are the x and y coordinates based on the virtual board (board_rows[]) 
+ * Instead of going by (8,8), (8,16), these are (1,1) and (1,2)
+ * @param color
+ * Color of block that is being drawn (white will erase)
+ */
+void draw_block(int virtual_row, int virtual_col, int color) {
+    unsigned int tile = EMPTY_TILE;
 
-    if (collision_rotation(new_x, new_y, current_shape)) {
-        return;
+    // tetris shape colors map to tile id = shape + 1
+    for (int shape = 0; shape < NUM_OF_TETRIS_SHAPES; shape++) {
+        if (shape_color[shape] == color) {
+            tile = shape + 1;
+        }
     }
-
-    // clear old posititon from physical and virtual screens
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        draw_block(
-            (current_shape->blocks[i].y) / BLOCK_DIMENSION, 
-            (current_shape->blocks[i].x) / BLOCK_DIMENSION,
-            WHITE
-        );
-
-        // clear from virtual screen
-        game_board[(current_shape->blocks[i].y) / BLOCK_DIMENSION][(current_shape->blocks[i].x) / BLOCK_DIMENSION].color = WHITE;
-        game_board[(current_shape->blocks[i].y) / BLOCK_DIMENSION][(current_shape->blocks[i].x) / BLOCK_DIMENSION].occupied = 0;
+    if (color == GRAY) {
+        tile = GRAY_TILE;
     }
 
-    // update shape with position
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        current_shape->blocks[i].x = new_x[i];
-        current_shape->blocks[i].y = new_y[i];
+    WRITE_GPIO(TILE_REG, TILE_MAP_ON + (virtual_row << BLOCK_ROW_POSITION) + (virtual_col << BLOCK_COL_POSITION) + tile);
+}
+
+/**
+ * @brief draws an 8x8 block on the game screen only if it is not already showing that color
+ * every block drawn in the play area should go through here so screen_colors stays in sync with the screen
+ * 
+ * @param virtual_row
+ * @param virtual_col
+ * @param color
+ */
+void update_block(int virtual_row, int virtual_col, int color) {
+    if (screen_colors[virtual_row][virtual_col] == color) {
+        return;
     }
 
-    // update physcial screen and virtual screen with new position
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        draw_block(
-            (current_shape->blocks[i].y) / BLOCK_DIMENSION, 
-            (current_shape->blocks[i].x) / BLOCK_DIMENSION,
-            shape_color[current_shape->shape]
-        );
+    screen_colors[virtual_row][virtual_col] = color;
+    draw_block(virtual_row, virtual_col, color);
+}
 
-        game_board[(current_shape->blocks[i].y) / BLOCK_DIMENSION][(current_shape->blocks[i].x) / BLOCK_DIMENSION].occupied = PIXEL_OCCUPIED;
-        game_board[(current_shape->blocks[i].y) / BLOCK_DIMENSION][(current_shape->blocks[i].x) / BLOCK_DIMENSION].color = shape_color[current_shape->shape];
+/**
+ * @brief clears the section of the screen where the tetris blocks fall
+ * 
+ */
+void clear_screen_play() {
+    // clear physical screen (one tile per block) and the shadow of the physical screen
+    for (int row = 0; row < GAME_BOARD_Y_MAX; row++) {
+        for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
+            WRITE_GPIO(TILE_REG, TILE_MAP_ON + (row << BLOCK_ROW_POSITION) + (col << BLOCK_COL_POSITION) + EMPTY_TILE);
+            screen_colors[row][col] = WHITE;
+        }
     }
 }
 
-//  move functions
+
 /**
- * @brief moves current shape left
+ * @brief redraws what a game_step changed
  * 
- * @param current_shape 
+ * @param game
+ * @param events  GAME_EVENT_* bits returned by game_step
  */
-void move_left(tetris_shape_obj_t *current_shape) {
-    // Getting the virtual row and col for game board array
-    vertex_t virtual[BLOCKS_PER_SHAPE];
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        virtual[i].y = current_shape->blocks[i].y / BLOCK_DIMENSION;
-        virtual[i].x = current_shape->blocks[i].x / BLOCK_DIMENSION;
+void draw_game_events(game_state_t *game, unsigned int events) {
+    // once the shape locks current_shape is already the next shape, so the locked shape goes into the tile map
+    // where it came to rest; the overlay is off until the next shape spawns so it never shows over shifted rows
+    if (events & GAME_EVENT_LOCKED) {
+        for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
+            update_block(game->locked_shape.blocks[i].y, game->locked_shape.blocks[i].x, shape_color[game->locked_shape.shape]);
+        }
+        WRITE_GPIO(PIECE_REG, 0);
     }
-    
-    if (collision_movement(left, current_shape)) {
-        return;
+    else if (events & GAME_EVENT_MOVED) {
+        draw_piece(game);
     }
 
-    // update new info
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        // move block left
-        current_shape->blocks[i].x -= BLOCK_DIMENSION;
-
-        // clear old spot
-        game_board[virtual[i].y][virtual[i].x].occupied = 0;
-        game_board[virtual[i].y][virtual[i].x].color = WHITE;
+    if (events & GAME_EVENT_LINES) {
+        line_clear_animation(game);
     }
 
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        // write new spot
-        game_board[virtual[i].y][virtual[i].x - 1].occupied = PIXEL_OCCUPIED;
-        game_board[virtual[i].y][virtual[i].x - 1].color = shape_color[current_shape->shape];
+    if (events & GAME_EVENT_SPAWNED) {
+        draw_piece(game);
+        WRITE_GPIO(NEXT_SHAPE_REG, game->next_shape);
     }
 
-    // update pivot point
-    current_shape->pivot_point.x -= BLOCK_DIMENSION;
-
-    // clear
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        draw_block(virtual[i].y, virtual[i].x, WHITE);
+    if (events & GAME_EVENT_SCORE) {
+        WRITE_GPIO(LINES_REG, game->lines);
+        WRITE_GPIO(LEVEL_REG, game->level);
+        WRITE_GPIO(SCORE_REG, game->score);
     }
+}
+
+/**
+ * @brief moves every row above a band of cleared rows down by the size of the band.
+ * The RTL shifts the play area tile map with a single write to ROW_SHIFT_REG, so only the
+ * shadow of the physical screen is shifted here; game_step already shifted the virtual board
+ * 
+ * @param bottom_row  lowest row of the band
+ * @param row_count   number of rows in the band
+ */
+void shift_rows_down(int bottom_row, int row_count) {
+    WRITE_GPIO(ROW_SHIFT_REG, (bottom_row << BLOCK_ROW_POSITION) + row_count);
 
-    // draw 
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        draw_block(virtual[i].y, virtual[i].x - 1, shape_color[current_shape->shape]);
+    for (int row = bottom_row; row >= GAME_BOARD_Y_MIN; row--) {
+        if (row - row_count >= GAME_BOARD_Y_MIN) {
+            for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
+                screen_colors[row][col] = screen_colors[row - row_count][col];
+            }
+        }
+        else {
+            for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
+                screen_colors[row][col] = WHITE;
+            }
+        }
     }
 }
 
 /**
- * @brief moves current shape right 
+ * @brief blinks the lines game_step cleared and removes them from the physical screen
  * 
- * @param current_shape 
+ * @param game  cleared_rows holds the lines
  */
-void move_right(tetris_shape_obj_t *current_shape) {
-    // Getting the virtual row and col
-    vertex_t virtual[BLOCKS_PER_SHAPE];
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        virtual[i].y = current_shape->blocks[i].y / BLOCK_DIMENSION;
-        virtual[i].x = current_shape->blocks[i].x / BLOCK_DIMENSION;
-    }
+void line_clear_animation(game_state_t *game) {
+    int line_count = game->line_count;
+    unsigned int flash_rows = 0;
 
-    if (collision_movement(right, current_shape)) {
-        return;
+    for (int k = 0; k < line_count; k++) {
+        flash_rows |= 1 << game->cleared_rows[k];
     }
 
-    // update new info
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        current_shape->blocks[i].x += BLOCK_DIMENSION;
-        // clear old spot
-        game_board[virtual[i].y][virtual[i].x].occupied = 0;
-        game_board[virtual[i].y][virtual[i].x].color = WHITE;
-    }
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        // write new spot
-        game_board[virtual[i].y][virtual[i].x + 1].occupied = PIXEL_OCCUPIED;
-        game_board[virtual[i].y][virtual[i].x + 1].color = shape_color[current_shape->shape];
+    // do a little blink animation (4 times) before erasing the lines; the RTL draws the flashing rows gray
+    for (int i = 0; i < 4; i++) {
+        WRITE_GPIO(FLASH_ROWS_REG, flash_rows);
+        wait_frames(FLASH_FRAMES);
+        WRITE_GPIO(FLASH_ROWS_REG, 0);
+        wait_frames(FLASH_FRAMES);
     }
 
-    // update pivot point
-    current_shape->pivot_point.x += BLOCK_DIMENSION;
+    // remove the lines the same way game_step did, starting from the highest band of adjacent lines;
+    // cleared_rows goes from the bottom up
+    for (int i = line_count-1; i >= 0; ) {
+        int band = 1;
 
-    // clear old position physcial screen
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        draw_block(virtual[i].y, virtual[i].x, WHITE);
+        while ((i - band >= 0) && (game->cleared_rows[i - band] == game->cleared_rows[i] + band)) {
+            band++;
+        }
+        shift_rows_down(game->cleared_rows[i] + band - 1, band);
+        i -= band;
     }
+}
 
-    // draw new position physical screen
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        draw_block(virtual[i].y, virtual[i].x + 1, shape_color[current_shape->shape]);
-    }
+
+/**
+ * @brief sets the UART to 115200 baud, 8 data bits, no parity and 1 stop bit with its interrupts off; the same
+ * setup as config_uart() of common/drivers/uart, so builds that do not print through the UART can still send
+ */
+void init_uart() {
+    unsigned int divisor = (CLOCK_FREQUENCY + UART_BAUD_RATE * 8) / (UART_BAUD_RATE * 16);
+
+    WRITE_GPIO(UART_LCR_REG, UART_LCR_DLAB);
+    WRITE_GPIO(UART_DLM_REG, divisor >> 8);
+    WRITE_GPIO(UART_DLL_REG, divisor & 0xFF);
+    WRITE_GPIO(UART_LCR_REG, UART_LCR_8N1);
+    WRITE_GPIO(UART_IER_REG, 0);
 }
 
 /**
- * @brief moves current shape down
- * 
- * @param current_shape 
+ * @brief routes the UART, keyboard and vertical blank interrupts through the VeeR PIC and turns on machine external
+ * interrupts. All gateways are level triggered; the UART request stays high until uart_isr() refills the transmit
+ * FIFO or turns the interrupt off, the keyboard one until keyboard_isr() empties the key event FIFO, the vertical
+ * blank one until vblank_isr() clears it
  */
-void move_down(tetris_shape_obj_t *current_shape) {
-    // Getting the virtual row and col
-    vertex_t virtual[BLOCKS_PER_SHAPE];
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        virtual[i].y = current_shape->blocks[i].y / BLOCK_DIMENSION;
-        virtual[i].x = current_shape->blocks[i].x / BLOCK_DIMENSION;
-    }
-    
-    if (collision_movement(down, current_shape)) {
-        // lock in place
-        current_shape->is_not_locked = false;
-        return;
+void init_interrupts() {
+    const unsigned int irq_ids[] = {UART_IRQ_ID, PS2_IRQ_ID, VGA_IRQ_ID};
+
+    WRITE_GPIO(PIC_MPICCFG, 0);                    // standard priority order
+    for (unsigned int i = 0; i < sizeof(irq_ids) / sizeof(irq_ids[0]); i++) {
+        WRITE_GPIO(PIC_MEIGWCTRL(irq_ids[i]), 0);  // level triggered, active high
+        WRITE_GPIO(PIC_MEIGWCLR(irq_ids[i]), 0);
+        WRITE_GPIO(PIC_MEIPL(irq_ids[i]), MAX_IRQ_PRIORITY);
+        WRITE_GPIO(PIC_MEIE(irq_ids[i]), 1);
     }
 
-    current_shape->lines_moved++;
+    // count frames from the first vertical blank on
+    vblank_count = READ_GPIO(FRAME_REG) & FRAME_COUNT_MASK;
+    WRITE_GPIO(FRAME_REG, VBLANK_PENDING + FRAME_IRQ_ON);
 
-    // update new info
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        current_shape->blocks[i].y += BLOCK_DIMENSION;
-        // clear old spot
-        game_board[virtual[i].y][virtual[i].x].occupied = 0;
-        game_board[virtual[i].y][virtual[i].x].color = WHITE;
-    }
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        // wire new spot
-        game_board[virtual[i].y + 1][virtual[i].x].occupied = PIXEL_OCCUPIED;
-        game_board[virtual[i].y + 1][virtual[i].x].color = shape_color[current_shape->shape];
-    }
+    // take every priority; nothing is claimed yet
+    WRITE_CSR(MEIPT, 0);
+    WRITE_CSR(MEICIDPL, 0);
+    WRITE_CSR(MEICURPL, 0);
 
-    // update pivot point
-    current_shape->pivot_point.y += BLOCK_DIMENSION;
+    WRITE_CSR(MTVEC, (uintptr_t)trap_handler);
+    SET_CSR(MIE, MIE_MEIE);
+    SET_CSR(MSTATUS, MSTATUS_MIE);
+}
 
-    // clear old position on physical screen
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        draw_block(virtual[i].y, virtual[i].x, WHITE);
+/**
+ * @brief machine trap handler (mtvec direct mode); claims the highest priority PIC interrupt
+ * and calls its service routine. Exceptions share the vector and never return, see exception_halt()
+ */
+void INTERRUPT_HANDLER trap_handler() {
+    unsigned int cause = 0;
+    unsigned int claim = 0;
+
+    READ_CSR(MCAUSE, cause);
+    if (!(cause & MCAUSE_INTERRUPT)) {
+        exception_halt(cause);
     }
 
-    // draw new position on physical screen
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        draw_block(virtual[i].y + 1, virtual[i].x, shape_color[current_shape->shape]);
+    WRITE_CSR(MEICPCT, 0);
+    READ_CSR(MEIHAP, claim);
+
+    switch ((claim >> 2) & 0xFF) {
+        case UART_IRQ_ID:
+            uart_isr();
+            break;
+        case PS2_IRQ_ID:
+            keyboard_isr();
+            break;
+        case VGA_IRQ_ID:
+            vblank_isr();
+            break;
     }
 }
 
 /**
- * @brief draws the block at the initial position
- * 
- * @param tetris_obj 
+ * @brief parks the core after an exception (illegal instruction, misaligned or faulting access, ecall, ebreak)
+ * instead of returning to the instruction that trapped and trapping again. Interrupts stay off; the exception
+ * code goes up in the score section and the whole play area blinks gray, so a halted board can be told apart
+ * from a hung one
+ *
+ * @param cause  mcause
  */
-void spawn_block(tetris_shape_obj_t *tetris_obj) {
-    // unsigned short int game_board[18][10] = {0};
-    // 18 rows and 10 column
-    if (tetris_obj->shape == i_shape) {
-        //i_shape
-        game_board[1][3].occupied = PIXEL_OCCUPIED; game_board[1][3].color = I_SHAPE_COLOR;
-        game_board[1][4].occupied = PIXEL_OCCUPIED; game_board[1][4].color = I_SHAPE_COLOR;
-        game_board[1][5].occupied = PIXEL_OCCUPIED; game_board[1][5].color = I_SHAPE_COLOR;
-        game_board[1][6].occupied = PIXEL_OCCUPIED; game_board[1][6].color = I_SHAPE_COLOR;
-        
-        draw_block(1,3,I_SHAPE_COLOR);
-        draw_block(1,4,I_SHAPE_COLOR);
-        draw_block(1,5,I_SHAPE_COLOR);
-        draw_block(1,6,I_SHAPE_COLOR);
-        
-    }
-    else if (tetris_obj->shape == j_shape) {
-        //j_shape
-        game_board[1][3].occupied = PIXEL_OCCUPIED; game_board[1][3].color = J_SHAPE_COLOR;
-        game_board[1][4].occupied = PIXEL_OCCUPIED; game_board[1][4].color = J_SHAPE_COLOR;
-        game_board[1][5].occupied = PIXEL_OCCUPIED; game_board[1][5].color = J_SHAPE_COLOR;
-        game_board[2][5].occupied = PIXEL_OCCUPIED; game_board[2][5].color = J_SHAPE_COLOR;
-        
-        draw_block(1,3,J_SHAPE_COLOR);
-        draw_block(1,4,J_SHAPE_COLOR);
-        draw_block(1,5,J_SHAPE_COLOR);
-        draw_block(2,5,J_SHAPE_COLOR);
-    }
-    else if (tetris_obj->shape == l_shape) {
-        //l_shape
-        game_board[1][3].occupied = PIXEL_OCCUPIED; game_board[1][3].color = L_SHAPE_COLOR;
-        game_board[1][4].occupied = PIXEL_OCCUPIED; game_board[1][4].color = L_SHAPE_COLOR;
-        game_board[1][5].occupied = PIXEL_OCCUPIED; game_board[1][5].color = L_SHAPE_COLOR;
-        game_board[2][3].occupied = PIXEL_OCCUPIED; game_board[2][3].color = L_SHAPE_COLOR;
-        
-        draw_block(1,3,L_SHAPE_COLOR);
-        draw_block(1,4,L_SHAPE_COLOR);
-        draw_block(1,5,L_SHAPE_COLOR);
-        draw_block(2,3,L_SHAPE_COLOR);
-    }
-    else if (tetris_obj->shape == o_shape) {
-        //o_shape
-        game_board[0][3].occupied = PIXEL_OCCUPIED; game_board[0][3].color = O_SHAPE_COLOR;
-        game_board[0][4].occupied = PIXEL_OCCUPIED; game_board[0][4].color = O_SHAPE_COLOR;
-        game_board[1][3].occupied = PIXEL_OCCUPIED; game_board[1][3].color = O_SHAPE_COLOR;
-        game_board[1][4].occupied = PIXEL_OCCUPIED; game_board[1][4].color = O_SHAPE_COLOR;
-        
-        draw_block(0,3,O_SHAPE_COLOR);
-        draw_block(0,4,O_SHAPE_COLOR);
-        draw_block(1,3,O_SHAPE_COLOR);
-        draw_block(1,4,O_SHAPE_COLOR);
-    }
-    else if (tetris_obj->shape == s_shape) {
-        //s_shape
-        game_board[1][4].occupied = PIXEL_OCCUPIED; game_board[1][4].color = S_SHAPE_COLOR;
-        game_board[1][5].occupied = PIXEL_OCCUPIED; game_board[1][5].color = S_SHAPE_COLOR;
-        game_board[2][3].occupied = PIXEL_OCCUPIED; game_board[2][3].color = S_SHAPE_COLOR;
-        game_board[2][4].occupied = PIXEL_OCCUPIED; game_board[2][4].color = S_SHAPE_COLOR;
-        
-        draw_block(1,4,S_SHAPE_COLOR);
-        draw_block(1,5,S_SHAPE_COLOR);
-        draw_block(2,3,S_SHAPE_COLOR);
-        draw_block(2,4,S_SHAPE_COLOR);
-    }
-    else if (tetris_obj->shape == t_shape) {
-        //t_shape
-        game_board[1][3].occupied = PIXEL_OCCUPIED; game_board[1][3].color = T_SHAPE_COLOR;
-        game_board[1][4].occupied = PIXEL_OCCUPIED; game_board[1][4].color = T_SHAPE_COLOR;
-        game_board[1][5].occupied = PIXEL_OCCUPIED; game_board[1][5].color = T_SHAPE_COLOR;
-        game_board[2][4].occupied = PIXEL_OCCUPIED; game_board[2][4].color = T_SHAPE_COLOR;
-        
-        draw_block(1,3,T_SHAPE_COLOR);
-        draw_block(1,4,T_SHAPE_COLOR);
-        draw_block(1,5,T_SHAPE_COLOR);
-        draw_block(2,4,T_SHAPE_COLOR);
-    }
-    else if (tetris_obj->shape == z_shape) {
-        //z_shape
-        game_board[1][3].occupied = PIXEL_OCCUPIED; game_board[1][3].color = Z_SHAPE_COLOR;
-        game_board[1][4].occupied = PIXEL_OCCUPIED; game_board[1][4].color = Z_SHAPE_COLOR;
-        game_board[2][4].occupied = PIXEL_OCCUPIED; game_board[2][4].color = Z_SHAPE_COLOR;
-        game_board[2][5].occupied = PIXEL_OCCUPIED; game_board[2][5].color = Z_SHAPE_COLOR;
-        
-        draw_block(1,3,Z_SHAPE_COLOR);
-        draw_block(1,4,Z_SHAPE_COLOR);
-        draw_block(2,4,Z_SHAPE_COLOR);
-        draw_block(2,5,Z_SHAPE_COLOR);
-    }
+void exception_halt(unsigned int cause) {
+    unsigned int rows = 0;
+    unsigned int start = 0;
+
+    CLEAR_CSR(MSTATUS, MSTATUS_MIE);
+    WRITE_GPIO(RAM_REG, (1 << 31));
+    WRITE_GPIO(TILE_REG, TILE_MAP_ON + EMPTY_TILE);
+    WRITE_GPIO(SCORE_REG, ((cause / 10) << 4) | (cause % 10)); // exception codes are below 32
 
+    while (true) {
+        rows ^= ALL_PLAY_ROWS;
+        WRITE_GPIO(FLASH_ROWS_REG, rows);
+        start = READ_GPIO(MTIME_REG);
+        while (READ_GPIO(MTIME_REG) - start < HALT_BLINK_TICKS) {
+        }
+    }
 }
 
 /**
- * @brief moves the position register off screen so no unwanted pixel get displayed on screen. 
- * value in register persist so we need to explicitly move the register off screen.
- * 
+ * @brief counts the display frames since the last vertical blank interrupt; more than one if the interrupt
+ * was held off for a whole frame
  */
-void stop_drawing() {
-    int position = 0;
+void vblank_isr() {
+    unsigned int count = 0;
 
-    // move pixel position offscreen so that vga does not write to unwanted pixel
-    position = (1 << 31) + ((8*5) << ROW_POSITION) + (8*16);
-    WRITE_GPIO(RAM_REG, position);
+    WRITE_GPIO(FRAME_REG, VBLANK_PENDING + FRAME_IRQ_ON);
+    count = READ_GPIO(FRAME_REG) & FRAME_COUNT_MASK;
+    display_frame += (count - vblank_count) & FRAME_COUNT_MASK;
+    vblank_count = count;
 }
 
-/** draw_block
- * @brief
- * draws an 8x8 block on the screen
- * picking the color will draw or erase(white) a tetrimino
+/**
+ * @brief sleeps (wfi) until the next interrupt unless the display already moved past frame, or a key event waits
+ * in the key ring and wake_on_keys is set. Interrupts are held off around the check so one that comes in just
+ * before the wfi is not slept through; wfi still wakes on it and the trap is taken once they are back on
  *
- * @param virtual_row
- * @param virtual_col
- * These are the x and y coordinates based on game_board[][] 
- * Instead of going by (8,8), (8,16), these are (1,1) and (1,2)
- * @param color
- * Color of block that is being drawn (white will erase)
+ * @param frame
+ * @param wake_on_keys  false if the caller leaves key events in the ring
  */
-void draw_block(int virtual_row, int virtual_col, int color) {
-    //this is used to draw the graphics for the blocks
-    int position = 0;
-    int actual_row = virtual_row * 8 + GAME_SCREEN_ROW_MIN;
-    int actual_col = virtual_col * 8 + GAME_SCREEN_COL_MIN;
-    int final_row = actual_row + 8;
-    int final_col = actual_col + 8;
-    WRITE_GPIO(RGB_REG, color);
-
-    // MAKES SOLID COLOR
-    for (int i = actual_row; i < final_row; i++) {
-        position = (position & COL_POSITION_MASK) + (i << ROW_POSITION);
-        for (int j = actual_col; j < final_col; j++) {
-            position = (position & ROW_POSITION_MASK) + j;
-
-            WRITE_GPIO(RAM_REG, position | MSB);
-        }
+void sleep_until_interrupt(unsigned int frame, bool wake_on_keys) {
+    CLEAR_CSR(MSTATUS, MSTATUS_MIE);
+    if (display_frame == frame && !(wake_on_keys && key_ring_tail != key_ring_head)) {
+        WAIT_FOR_INTERRUPT();
     }
+    SET_CSR(MSTATUS, MSTATUS_MIE);
+}
 
-    switch (color) {
-        case I_SHAPE_COLOR:
-        case J_SHAPE_COLOR:
-        case L_SHAPE_COLOR:
-        case O_SHAPE_COLOR:
-        case S_SHAPE_COLOR:
-        case T_SHAPE_COLOR:
-        case Z_SHAPE_COLOR:
-            WRITE_GPIO(RGB_REG, BLACK);
-            // top and bottom side outline
-            for (int col = actual_col; col < final_col; col++) {
-                // top row
-                position = (actual_row << ROW_POSITION) + col;
-                WRITE_GPIO(RAM_REG, position | MSB);
-
-                // bottom row
-                position = ((actual_row + (BLOCK_DIMENSION - 1)) << ROW_POSITION) + col;
-                WRITE_GPIO(RAM_REG, position | MSB);
-            }
-            // left and right side outline
-            for (int row = actual_row; row < final_row; row++) {
-                // top row
-                position = (row << ROW_POSITION) + actual_col;
-                WRITE_GPIO(RAM_REG, position | MSB);
-
-                // bottom row
-                position = (row << ROW_POSITION) + (actual_col + (BLOCK_DIMENSION - 1));
-                WRITE_GPIO(RAM_REG, position | MSB);
-            }
-
-            // draw small outline within the block
-            for (int col = actual_col + 2; col < final_col - 2; col++) {
-                // top row
-                position = ((actual_row + 2) << ROW_POSITION) + col;
-                WRITE_GPIO(RAM_REG, position | MSB);
-
-                // bottom row
-                position = ((actual_row + 5) << ROW_POSITION) + col;
-                WRITE_GPIO(RAM_REG, position | MSB);
-            }
-            // left and right side outline
-            for (int row = actual_row + 2; row < final_row - 2; row++) {
-                // top row
-                position = (row << ROW_POSITION) + (actual_col + 2);
-                WRITE_GPIO(RAM_REG, position | MSB);
-
-                // bottom row
-                position = (row << ROW_POSITION) + (actual_col + 5);
-                WRITE_GPIO(RAM_REG, position | MSB);
-            }
+/**
+ * @brief waits for a number of display frames; key events are left in the key ring
+ *
+ * @param frames
+ */
+void wait_frames(unsigned int frames) {
+    unsigned int first_frame = display_frame;
 
-            // make center white
-            
-            for (int row = actual_row + 3; row < final_row - 3; row++) {
-                position = (row << ROW_POSITION) + (position & COL_POSITION_MASK);
+    while (display_frame - first_frame < frames) {
+        sleep_until_interrupt(display_frame, false);
+    }
+}
 
-                for (int col = actual_col + 3; col < final_col - 3; col++) {
-                    position = (position & ROW_POSITION_MASK) + (col);
+/**
+ * @brief moves every key event decoded by the keyboard RTL into the key ring and notes when they came in
+ */
+void keyboard_isr() {
+    unsigned int key_event = READ_GPIO(KEY_EVENT_REG);
+    unsigned int head = key_ring_head;
+
+    key_event_time = READ_GPIO(MTIME_REG);
+    while (key_event & KEY_EVENT_VALID) {
+        // drop the event if the game loop has fallen a whole ring behind
+        if (head - key_ring_tail < KEY_RING_SIZE) {
+            key_ring[head & (KEY_RING_SIZE - 1)] = key_event & KEY_EVENT_MASK;
+            head++;
+            key_ring_head = head; // publish only after the event is stored
+        }
+        key_event = READ_GPIO(KEY_EVENT_REG);
+    }
+}
 
-                    WRITE_GPIO(RAM_REG, position | MSB);
-                    WRITE_GPIO(RGB_REG, WHITE);
-                }
-            }
+/**
+ * @brief takes the oldest key event out of the ring
+ * 
+ * @param key_event  scancode of the key; KEY_BREAK is set for a release, KEY_EXTENDED for an extended key,
+ *                   KEY_REPEAT for a typematic repeat of a key that is already down
+ * @return true if there was an event
+ */
+bool pop_key_event(unsigned short int *key_event) {
+    unsigned int tail = key_ring_tail;
 
-            // add shade for aesthetic
-            position = ((actual_row + 1) << ROW_POSITION) + (actual_col + 1);
-            WRITE_GPIO(RAM_REG, position | MSB);
-            position = ((actual_row + 1) << ROW_POSITION) + (actual_col + 2);
-            WRITE_GPIO(RAM_REG, position | MSB);
-            position = ((actual_row + 2) << ROW_POSITION) + (actual_col + 1);
-            WRITE_GPIO(RAM_REG, position | MSB);
-            break;
-        case WHITE:
-            break;
+    if (tail == key_ring_head) {
+        return false;
     }
 
-    stop_drawing();
+    *key_event = key_ring[tail & (KEY_RING_SIZE - 1)];
+    key_ring_tail = tail + 1; // free the slot only after the event is read
+    return true;
 }
 
 /**
- * @brief clears the section of the screen where the tetris blocks fall
+ * @brief empties the key ring
  * 
+ * @param key  scancode of the key to look for
+ * @return true if the key was pressed since the ring was last emptied
  */
-void clear_screen_play() {
-    unsigned int screen_position = 0;
-    WRITE_GPIO(RGB_REG, WHITE);
-    
-    // clear physical screen
-    for (int row = GAME_SCREEN_ROW_MIN; row < SCREEN_HEIGHT; row++) {
-        screen_position = (screen_position & COL_POSITION_MASK) + (row << ROW_POSITION);
-
-        for (int col = GAME_SCREEN_COL_MIN; col < GAME_SCREEN_COL_MAX; col++) {
-            screen_position = (screen_position & ROW_POSITION_MASK) + col;
+bool key_event_pending(unsigned short int key) {
+    unsigned short int key_event = 0;
+    bool pressed = false;
 
-            WRITE_GPIO(RAM_REG, screen_position | MSB);
-            
+    while (pop_key_event(&key_event)) {
+        if (key_event == key) {
+            pressed = true;
         }
     }
 
-    stop_drawing();
+    return pressed;
+}
 
-    // clear virtual board 
-    for (int i = 0; i < 18; i++) {
-        for (int j = 0; j < 10; j++) {
-            game_board[i][j].color = 0;
-            game_board[i][j].occupied = 0;
+/**
+ * @brief sends a game record out of the UART as text, so it survives any terminal and '\n' becoming "\r\n":
+ *   REPLAY seed=<8 hex digits>
+ *   record bytes, two hex digits each, REPLAY_LINE_BYTES per line
+ *   END length=<hex> locks=<hex> score=<hex> hash=<replay_board_hash, hex> truncated=<0 or 1> lost=<hex>
+ * lost counts the characters the UART ring dropped since reset; the record itself waits for room line by line so
+ * none of it is lost. applications/host/tetris_replay reads the records out of a log of the UART
+ *
+ * @param record
+ * @param game    game the record ended with
+ */
+void send_record(const replay_record_t *record, const game_state_t *game) {
+    uart_wait_for_room(UART_LINE_CHARS);
+    uart_send_string("REPLAY seed=");
+    uart_send_hex(record->seed, 8);
+    uart_send_char('\n');
+
+    for (unsigned int i = 0; i < record->length; i++) {
+        if (i % REPLAY_LINE_BYTES == 0) {
+            uart_wait_for_room(UART_LINE_CHARS);
+        }
+        uart_send_hex(record->bytes[i], 2);
+        if ((i % REPLAY_LINE_BYTES == REPLAY_LINE_BYTES - 1) || (i == record->length - 1)) {
+            uart_send_char('\n');
         }
     }
+
+    uart_wait_for_room(UART_LINE_CHARS);
+    uart_send_string("END length=");
+    uart_send_hex(record->length, 4);
+    uart_send_string(" locks=");
+    uart_send_hex(record->locks, 4);
+    uart_send_string(" score=");
+    uart_send_hex(game->score, 6);
+    uart_send_string(" hash=");
+    uart_send_hex(replay_board_hash(game), 8);
+    uart_send_string(" truncated=");
+    uart_send_hex(record->truncated, 1);
+    uart_send_string(" lost=");
+    uart_send_hex(uart_dropped, 8);
+    uart_send_char('\n');
 }
 
+/**
+ * @brief sends a string out of the UART
+ *
+ * @param text
+ */
+void uart_send_string(const char *text) {
+    while (*text != '\0') {
+        uart_send_char(*text++);
+    }
+}
 
 /**
- * @brief 
- * Detect if a movement in direction will cause a collision
- * 
- * @param movement_direction
- * 0 = moving left
- * 1 = moving right
- * 2 = moving down
- * @param current_shape
- * Information on current tetromino being manipulated/played
- * The current_shape->blocks[] is being extracted for this function
+ * @brief sends a number out of the UART as hex digits, most significant first
+ *
+ * @param value
+ * @param digits  number of digits; leading zeros are sent
  */
-bool collision_movement(int movement_direction, tetris_shape_obj_t *current_shape) {
-    vertex_t coord[BLOCKS_PER_SHAPE]; // Stores converted x/y coordinates from current shape to game board x/y
-    bool collision = false;
-
-    // converting current_shape->blocks coordinates into game_board[][] usable coordinates
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        coord[i].x = current_shape->blocks[i].x / BLOCK_DIMENSION;
-        coord[i].y = current_shape->blocks[i].y / BLOCK_DIMENSION;
-        // marking gameboard to keep track of current shape
-        game_board[coord[i].y][coord[i].x].occupied = PIXEL_WILL_BE_FREED;
+void uart_send_hex(unsigned int value, int digits) {
+    for (int i = digits - 1; i >= 0; i--) {
+        uart_send_char("0123456789ABCDEF"[(value >> (4 * i)) & 0xF]);
     }
+}
 
-    // Checking for collision based on movement direction
-    // If the block is moving into a space that is occupied or out of bounds, collision is true
-    switch (movement_direction) {
-        case left:
-            for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-                if ((coord[i].x - 1 ) < GAME_BOARD_X_MIN) {
-                    collision = true;
-                    break;
-                } 
-                else if (game_board[coord[i].y][coord[i].x - 1].occupied == PIXEL_OCCUPIED) {
-                    collision = true;
-                    break;
-                }
-            }
-            break;
-        case right:
-            for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-                if ((coord[i].x + 1) >= GAME_BOARD_X_MAX) {
-                    collision = true;
-                    break;
-                } 
-                else if (game_board[coord[i].y][coord[i].x + 1].occupied == PIXEL_OCCUPIED) {
-                    collision = true;
-                    break;
-                }
-            }
-            break;
-        case down:
-            for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-                if ((coord[i].y + 1) >= GAME_BOARD_Y_MAX) {
-                    collision = true;
-                    break;
-                } 
-                else if (game_board[coord[i].y + 1][coord[i].x].occupied == PIXEL_OCCUPIED) {
-                    collision = true;
-                    break;
-                }
-            }
-            break;
+/**
+ * @brief puts a character in the UART ring for uart_isr() to send, followed by a carriage return after a new line
+ * like the driver in common/drivers/uart, whose busy-waiting uart_send_char (and the ee_printf buffer one) this
+ * replaces; ee_printf goes through here too. Never waits: a character that finds the ring full is dropped and
+ * counted in uart_dropped
+ *
+ * @param c
+ */
+void uart_send_char(char c) {
+    unsigned int head = uart_ring_head;
+
+    if (head - uart_ring_tail < UART_RING_SIZE) {
+        uart_ring[head & (UART_RING_SIZE - 1)] = c;
+        uart_ring_head = head + 1;
+    }
+    else {
+        uart_dropped++;
     }
 
-    // unmarking gameboard changes
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        game_board[coord[i].y][coord[i].x].occupied = PIXEL_OCCUPIED;
+    // uart_isr() only runs while its interrupt is on, and turns it off only with the ring empty, so whatever it
+    // last saw of the ring, the character is sent: by it, or by the interrupt turned on here
+    if (!uart_sending) {
+        uart_sending = true;
+        WRITE_GPIO(UART_IER_REG, UART_IER_THRE);
     }
 
-    return collision;
+    if (c == '\n') {
+        uart_send_char('\r');
+    }
 }
 
 /**
- * @brief
- * Detect if a rotation will cause a collision.
- *
- * @param rotation_x
- * @param rotation_y
- * These are what the x/y coordinates will be if the rotation happens; provided by rotation function.
- * @param current_shape
- * Information on current tetromino being manipulated/played
- * The current_shape->blocks[] is being extracted for this function
+ * @brief refills the empty transmit FIFO of the UART from the ring; turns the THRE interrupt off once the ring is
+ * empty, which also clears it
  */
-bool collision_rotation(unsigned int rotation_x[BLOCKS_PER_SHAPE], unsigned int rotation_y[BLOCKS_PER_SHAPE], tetris_shape_obj_t *current_shape) {
-    vertex_t coord_old[BLOCKS_PER_SHAPE];
-    vertex_t coord_new[BLOCKS_PER_SHAPE];
-    bool collision = false;
-
-    // converting screen coordinates into game_board[][] usable coordinates
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        coord_old[i].x = current_shape->blocks[i].x / BLOCK_DIMENSION;
-        coord_old[i].y = current_shape->blocks[i].y / BLOCK_DIMENSION;
-        coord_new[i].x = rotation_x[i] / BLOCK_DIMENSION;
-        coord_new[i].y = rotation_y[i] / BLOCK_DIMENSION;
-        // marking gameboard to keep track of current shape
-        game_board[coord_old[i].y][coord_old[i].x].occupied = PIXEL_WILL_BE_FREED;
-    }
+void uart_isr() {
+    unsigned int tail = uart_ring_tail;
+    unsigned int head = uart_ring_head;
 
-    // checking if new pixel location is out of bounds or is in occupied space
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        if (
-            (coord_new[i].x > (GAME_BOARD_X_MAX - 1)) || 
-            (coord_new[i].x < GAME_BOARD_X_MIN)       || 
-            (coord_new[i].y > (GAME_BOARD_Y_MAX - 1)) || 
-            (coord_new[i].y < GAME_BOARD_Y_MIN) 
-        ) {
-            collision = true;
-            break;
-        }
-        else if (game_board[coord_new[i].y][coord_new[i].x].occupied == PIXEL_OCCUPIED) {
-            collision = true;
-            break;
-        }
+    for (int i = 0; i < UART_FIFO_DEPTH && tail != head; i++) {
+        WRITE_GPIO(UART_THR_REG, uart_ring[tail & (UART_RING_SIZE - 1)]);
+        tail++;
     }
+    uart_ring_tail = tail;
 
-    // unmarking gameboard changes
-    for (int i = 0; i < BLOCKS_PER_SHAPE; i++) {
-        game_board[coord_old[i].y][coord_old[i].x].occupied = PIXEL_OCCUPIED;
+    if (tail == head) {
+        WRITE_GPIO(UART_IER_REG, 0);
+        uart_sending = false;
     }
+}
 
-    return collision;
+/**
+ * @brief sleeps (wfi) until the UART ring has room for a number of characters, for output that must not be dropped.
+ * Interrupts are held off around the check like in sleep_until_interrupt
+ *
+ * @param chars  at most UART_RING_SIZE
+ */
+void uart_wait_for_room(unsigned int chars) {
+    CLEAR_CSR(MSTATUS, MSTATUS_MIE);
+    while (UART_RING_SIZE - (uart_ring_head - uart_ring_tail) < chars) {
+        WAIT_FOR_INTERRUPT();
+        SET_CSR(MSTATUS, MSTATUS_MIE);
+        CLEAR_CSR(MSTATUS, MSTATUS_MIE);
+    }
+    SET_CSR(MSTATUS, MSTATUS_MIE);
 }
 
+#ifdef REPLAY_BENCH
 /**
- * @brief find how many lines are complete and clears them. Updates lines variable
- * 
- * @param lines 
+ * @brief no-input benchmark: plays the game of replay_bench.h over and over and sends the cost of its frames out of
+ * the UART after each run, so two firmware builds can be compared on the same game. Each frame runs the steps the
+ * game loop of main() ran in that frame, drawing included, but takes them from the record instead of the keyboard:
+ *   BENCH frames=<hex> ticks=<hex> busiest=<hex> dropped=<hex> score=<hex> ok|diverged
+ * ticks and busiest are mtime ticks of the frames that did not lock a shape (a lock waits out the line clear)
  */
-void line_clear(unsigned int *lines) {
-    int lines_to_clear[4] = {99, 99, 99, 99};
-    int line_count = 0;
-    // find the rows that are full
-    for (int row = 17; row > GAME_BOARD_Y_MIN; row--) {
-        for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
-            if (game_board[row][col].occupied != 1) {
-                break;
+void replay_benchmark() {
+    while (true) {
+        game_state_t game;
+        replay_reader_t reader;
+        unsigned int events = 0;
+        unsigned int input = 0;
+        unsigned int frame = 0;
+        unsigned int frame_time = 0;
+        unsigned int frame_ticks = 0;
+        unsigned int game_frame = 0;
+        unsigned int total_ticks = 0;
+        bool shape_locked = false;
+        bool matched = true;
+
+        WRITE_GPIO(RAM_REG, (1 << 31));
+        draw_tetris_game_background();
+        clear_screen_play();
+
+        game_init(&game, replay_bench_seed);
+        replay_reader_init(&reader, replay_bench_bytes, replay_bench_length);
+        WRITE_GPIO(LINES_REG, game.lines);
+        WRITE_GPIO(LEVEL_REG, game.level);
+        WRITE_GPIO(SCORE_REG, game.score);
+        draw_game_events(&game, GAME_EVENT_SPAWNED);
+        stop_drawing();
+        dropped_frames = 0;
+        busiest_frame_ticks = 0;
+
+        frame = display_frame;
+        while (!game.game_over && !reader.done && matched) {
+            while (display_frame == frame) {
+                sleep_until_interrupt(frame, false);
             }
-            if ((game_board[row][col].occupied == 1) && (col == GAME_BOARD_X_MAX-1)) {
-                lines_to_clear[line_count] = row;
-                line_count++;
+            dropped_frames += display_frame - frame - 1;
+            frame = display_frame;
+            frame_time = READ_GPIO(MTIME_REG);
+            shape_locked = false;
+
+            // key steps, then the frame step unless one of them locked the shape
+            while (matched && !shape_locked && replay_key_step(&reader, game_frame, &input)) {
+                events = game_step(&game, input);
+                matched = replay_check_step(&reader, &game, events);
+                draw_game_events(&game, events);
+                shape_locked = (events & GAME_EVENT_LOCKED) != 0;
             }
-        }
-    }
-    // leave if no lines have been cleared
-    if (line_count == 0) {  
-        return;
-    }
-    if (line_count > 4) {   
-        return;
-    }
+            if (matched && !shape_locked) {
+                events = game_step(&game, replay_frame_step(&reader, game_frame));
+                matched = replay_check_step(&reader, &game, events);
+                draw_game_events(&game, events);
+                shape_locked = (events & GAME_EVENT_LOCKED) != 0;
+            }
+            game_frame++;
 
-    // do a little blink animation (4 times) before erasing the lines
-    for (int i = 0; i < 4; i++) {
-        for (int k = 0; k < line_count; k++) {
-            // blink to gray
-            for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
-                draw_block(lines_to_clear[k], col, GRAY);
+            if (shape_locked) {
+                frame = display_frame;
             }
-        }
-        delay(100000);
-        for (int j = 0; j < line_count; j++) {
-            // blink back the block
-            for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
-                draw_block(lines_to_clear[j], col, game_board[lines_to_clear[j]][col].color);
+            else {
+                frame_ticks = READ_GPIO(MTIME_REG) - frame_time;
+                total_ticks += frame_ticks;
+                if (frame_ticks > busiest_frame_ticks) {
+                    busiest_frame_ticks = frame_ticks;
+                }
             }
         }
-        delay(100000);
-    }
 
-    // erase the lines
-    for (int i = 0; i < line_count; i++) {
-        for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
-            draw_block(lines_to_clear[i], col, WHITE);
-            // update game board
-            game_board[lines_to_clear[i]][col].occupied = 0;
-            game_board[lines_to_clear[i]][col].color = WHITE;
-        }
+        uart_wait_for_room(UART_LINE_CHARS);
+        uart_send_string("BENCH frames=");
+        uart_send_hex(game_frame, 8);
+        uart_send_string(" ticks=");
+        uart_send_hex(total_ticks, 8);
+        uart_send_string(" busiest=");
+        uart_send_hex(busiest_frame_ticks, 8);
+        uart_send_string(" dropped=");
+        uart_send_hex(dropped_frames, 8);
+        uart_send_string(" score=");
+        uart_send_hex(game.score, 6);
+        uart_send_string(matched ? " ok\n" : " diverged\n");
+        wait_frames(GAME_OVER_FRAMES);
     }
+}
+#endif
 
-    // update the game board starting from the highest missing line
-    for (int i = line_count-1; i >= 0; i--) {
-        for (int row = lines_to_clear[i]; row > GAME_BOARD_Y_MIN; row--) {
-            for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
-                game_board[row][col].occupied = game_board[row-1][col].occupied;
-                game_board[row][col].color = game_board[row-1][col].color;
-            }
-        }
-    }
+#ifdef CORE_BENCH
+/**
+ * @brief times game core routines against the code they replaced (core_bench.c) in core clocks, over and over, and
+ * sends each comparison out of the UART:
+ *   CORE <name> calls=<hex> new=<hex> old=<hex> ok|mismatch
+ * new and old are the mcycles of all the calls of each side. Interrupts are held off while a comparison runs so
+ * the vertical blank and keyboard interrupts are not counted in it
+ */
+void core_benchmark() {
+    core_bench_result_t result;
 
-    // draw the new game board from the BOTTOM, looks better
-    for (int row = 17; row >= GAME_BOARD_Y_MIN; row--) {
-        for (int col = 0; col < GAME_BOARD_X_MAX; col++) {
-            if (game_board[row][col].occupied != 1) {
-                draw_block(row, col, WHITE);
-                continue;
-            }
-            draw_block(row, col, game_board[row][col].color);
-        }
+    while (true) {
+        CLEAR_CSR(MSTATUS, MSTATUS_MIE);
+        bench_rotation(&result, read_mcycle, CORE_BENCH_ROUNDS);
+        SET_CSR(MSTATUS, MSTATUS_MIE);
+        send_core_bench("rotation", &result);
+
+        CLEAR_CSR(MSTATUS, MSTATUS_MIE);
+        bench_score_update(&result, read_mcycle, CORE_BENCH_ROUNDS);
+        SET_CSR(MSTATUS, MSTATUS_MIE);
+        send_core_bench("score", &result);
+
+        wait_frames(GAME_OVER_FRAMES);
     }
+}
 
-    *lines += line_count;
-}
\ No newline at end of file
+/**
+ * @brief sends one core_bench comparison out of the UART
+ *
+ * @param name
+ * @param result
+ */
+void send_core_bench(const char *name, const core_bench_result_t *result) {
+    uart_wait_for_room(UART_LINE_CHARS);
+    uart_send_string("CORE ");
+    uart_send_string(name);
+    uart_send_string(" calls=");
+    uart_send_hex(result->calls, 8);
+    uart_send_string(" new=");
+    uart_send_hex(result->new_ticks, 8);
+    uart_send_string(" old=");
+    uart_send_hex(result->old_ticks, 8);
+    uart_send_string(result->matched ? " ok\n" : " mismatch\n");
+}
+
+/**
+ * @brief bench_counter_t on the board
+ *
+ * @return low word of mcycle
+ */
+unsigned int read_mcycle() {
+    unsigned int cycles = 0;
+
+    READ_CSR(MCYCLE, cycles);
+    return cycles;
+}
+#endif
@@ -0,0 +1,239 @@
+/**
+* Brief:
+* game records and their replay; see replay.h
+**/
+#include "replay.h"
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+/** function declarations **/
+void replay_record_byte(replay_record_t *record, unsigned int byte);
+void replay_decode_next(replay_reader_t *reader);
+
+
+/**
+ * @brief empties the record of a game that game_init is about to start with seed
+ *
+ * @param record
+ * @param seed
+ */
+void replay_record_start(replay_record_t *record, unsigned int seed) {
+    record->seed = seed;
+    record->length = 0;
+    record->frame = 0;
+    record->locks = 0;
+    record->truncated = false;
+}
+
+/**
+ * @brief records one game_step; a frame step with nothing else in it is left out, the replay puts it back, unless
+ * it locks the shape: the lock hash has to follow the step that locked.
+ * Once the buffer is full the rest of the game is not recorded and the record is marked truncated
+ *
+ * @param record
+ * @param frame   game loop frame of the step, counted from game_init
+ * @param input   GAME_INPUT_* bits the step was given
+ * @param game    game after the step
+ * @param events  GAME_EVENT_* bits the step returned
+ */
+void replay_record_step(replay_record_t *record, unsigned int frame, unsigned int input, const game_state_t *game,
+                        unsigned int events) {
+    unsigned int delta = frame - record->frame;
+    unsigned int hash = 0;
+
+    if (record->truncated) {
+        return;
+    }
+    if (record->length + REPLAY_MAX_STEP_BYTES + 3 > REPLAY_BUFFER_SIZE) {
+        record->truncated = true;
+        return;
+    }
+
+    if ((input != GAME_INPUT_FRAME) || (events & GAME_EVENT_LOCKED)) {
+        if (delta < REPLAY_DELTA_ESCAPE) {
+            replay_record_byte(record, (delta << REPLAY_DELTA_POSITION) | (input & REPLAY_INPUT_MASK));
+        }
+        else {
+            replay_record_byte(record, (REPLAY_DELTA_ESCAPE << REPLAY_DELTA_POSITION) | (input & REPLAY_INPUT_MASK));
+            // LEB128: 7 bits at a time, low bits first, bit 7 set on every byte but the last
+            for (delta -= REPLAY_DELTA_ESCAPE; delta >= 0x80; delta >>= 7) {
+                replay_record_byte(record, (delta & 0x7F) | 0x80);
+            }
+            replay_record_byte(record, delta);
+        }
+        record->frame = frame;
+    }
+
+    if (events & GAME_EVENT_LOCKED) {
+        hash = replay_lock_hash(game);
+        replay_record_byte(record, REPLAY_LOCK);
+        replay_record_byte(record, hash & 0xFF);
+        replay_record_byte(record, hash >> 8);
+        record->locks++;
+    }
+}
+
+/**
+ * @brief appends a byte to the record; replay_record_step checks for room first
+ *
+ * @param record
+ * @param byte
+ */
+void replay_record_byte(replay_record_t *record, unsigned int byte) {
+    record->bytes[record->length++] = byte;
+}
+
+/**
+ * @brief 32-bit FNV-1a of the locked blocks (colors included), the falling shape and the next shape
+ *
+ * @param game
+ * @return unsigned int
+ */
+unsigned int replay_board_hash(const game_state_t *game) {
+    unsigned int hash = FNV_OFFSET;
+
+    for (int row = 0; row < GAME_BOARD_Y_MAX; row++) {
+        hash = (hash ^ game->board_colors[row]) * FNV_PRIME;
+    }
+    hash = (hash ^ game->current_shape.shape) * FNV_PRIME;
+    hash = (hash ^ game->next_shape) * FNV_PRIME;
+
+    return hash;
+}
+
+/**
+ * @brief replay_board_hash folded down to the 16 bits recorded at every lock
+ *
+ * @param game
+ * @return unsigned int
+ */
+unsigned int replay_lock_hash(const game_state_t *game) {
+    unsigned int hash = replay_board_hash(game);
+
+    return (hash ^ (hash >> 16)) & 0xFFFF;
+}
+
+/**
+ * @brief starts reading a record from its first step
+ *
+ * @param reader
+ * @param bytes   steps of the record
+ * @param length  bytes
+ */
+void replay_reader_init(replay_reader_t *reader, const unsigned char *bytes, unsigned int length) {
+    reader->bytes = bytes;
+    reader->length = length;
+    reader->position = 0;
+    reader->frame = 0;
+    reader->done = false;
+    replay_decode_next(reader);
+}
+
+/**
+ * @brief decodes the next step or lock hash into frame, input and hash; done once the bytes run out
+ * (a step cut off by the end of the bytes counts as no step)
+ *
+ * @param reader
+ */
+void replay_decode_next(replay_reader_t *reader) {
+    unsigned int byte = 0;
+    unsigned int delta = 0;
+
+    if (reader->position >= reader->length) {
+        reader->done = true;
+        return;
+    }
+
+    byte = reader->bytes[reader->position++];
+    reader->input = byte & REPLAY_INPUT_MASK;
+    if (byte == REPLAY_LOCK) {
+        if (reader->position + 2 > reader->length) {
+            reader->done = true;
+            return;
+        }
+        reader->hash = reader->bytes[reader->position] | (reader->bytes[reader->position + 1] << 8);
+        reader->position += 2;
+        return;
+    }
+
+    delta = byte >> REPLAY_DELTA_POSITION;
+    if (delta == REPLAY_DELTA_ESCAPE) {
+        unsigned int shift = 0;
+
+        do {
+            if (reader->position >= reader->length) {
+                reader->done = true;
+                return;
+            }
+            byte = reader->bytes[reader->position++];
+            delta += (byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+    }
+    reader->frame += delta;
+}
+
+/**
+ * @brief takes the next key step of a frame; call it until it returns false, or the shape locks, before the
+ * frame step like the game loop does
+ *
+ * @param reader
+ * @param frame  game loop frame being replayed
+ * @param input  GAME_INPUT_* bits of the step
+ * @return true if the record has another key step in this frame
+ */
+bool replay_key_step(replay_reader_t *reader, unsigned int frame, unsigned int *input) {
+    if (reader->done || reader->input == REPLAY_LOCK || reader->frame != frame || (reader->input & GAME_INPUT_FRAME)) {
+        return false;
+    }
+
+    *input = reader->input;
+    replay_decode_next(reader);
+    return true;
+}
+
+/**
+ * @brief takes the frame step of a frame
+ *
+ * @param reader
+ * @param frame  game loop frame being replayed
+ * @return GAME_INPUT_* bits of the step; GAME_INPUT_FRAME alone if the record left it out
+ */
+unsigned int replay_frame_step(replay_reader_t *reader, unsigned int frame) {
+    unsigned int input = GAME_INPUT_FRAME;
+
+    if (!reader->done && reader->input != REPLAY_LOCK && reader->frame == frame && (reader->input & GAME_INPUT_FRAME)) {
+        input = reader->input;
+        replay_decode_next(reader);
+    }
+
+    return input;
+}
+
+/**
+ * @brief checks a replayed step against the record: a step that locks the shape has to find the same lock hash
+ * next in the record, and one that does not must not
+ *
+ * @param reader
+ * @param game    game after the step
+ * @param events  GAME_EVENT_* bits the step returned
+ * @return false if the replay is no longer playing the recorded game
+ */
+bool replay_check_step(replay_reader_t *reader, const game_state_t *game, unsigned int events) {
+    bool lock_next = !reader->done && reader->input == REPLAY_LOCK;
+
+    if (!(events & GAME_EVENT_LOCKED)) {
+        return !lock_next;
+    }
+    // a truncated record ends without the lock hash of the last step
+    if (reader->done) {
+        return true;
+    }
+    if (!lock_next || reader->hash != replay_lock_hash(game)) {
+        return false;
+    }
+
+    replay_decode_next(reader);
+    return true;
+}
@@ -0,0 +1,59 @@
+/**
+* Brief:
+* records a game as its seed plus the input of every game_step, so the same game can be played again through
+* game_core: by the host replay tool (applications/host, tetris_replay) as fast as it goes, or on the board by the
+* REPLAY_BENCH build of main.c to compare the frame costs of two firmware builds. Like game_core, nothing in here
+* touches a register.
+*
+* The game loop runs once per frame: zero or more key steps, then the frame step (GAME_INPUT_FRAME) unless a key
+* step locked the shape. A record holds every step except a frame step with nothing else in it that does not lock
+* the shape, which a replay puts back on its own. Each step is one byte, more only after a long run of frames without
+* a step:
+*   bits 5:0 = GAME_INPUT_* bits (never 0)
+*   bits 7:6 = frames since the step before it (0-2); 3 = a LEB128 number of frames - 3 follows
+* After every step that locks the shape a 0x00 byte and a 16-bit hash of the board and the shapes
+* dealt (low byte first) let the replay check that it is still playing the same game
+**/
+#ifndef __REPLAY__
+#define __REPLAY__
+
+#include <stdbool.h>
+#include "game_core.h"
+
+#define REPLAY_BUFFER_SIZE 4096  // bytes of steps; a game of about 20 minutes
+#define REPLAY_INPUT_MASK  0x3F
+#define REPLAY_DELTA_POSITION 6
+#define REPLAY_DELTA_ESCAPE 3    // delta field value that is followed by a LEB128 frame count
+#define REPLAY_LOCK 0x00         // followed by replay_lock_hash() of the game, 2 bytes
+#define REPLAY_MAX_STEP_BYTES 6  // step byte + LEB128 of a 32-bit frame count
+
+typedef struct replay_record {
+    unsigned int seed;           // game_init seed
+    unsigned char bytes[REPLAY_BUFFER_SIZE];
+    unsigned int length;
+    unsigned int frame;          // frame of the last step recorded
+    unsigned int locks;
+    bool truncated;              // the buffer filled up; steps after that were not recorded
+} replay_record_t;
+
+typedef struct replay_reader {
+    const unsigned char *bytes;
+    unsigned int length;
+    unsigned int position;       // next byte to decode
+    unsigned int frame;          // frame of the next step
+    unsigned int input;          // GAME_INPUT_* bits of the next step; REPLAY_LOCK if a lock hash is next
+    unsigned int hash;           // lock hash if input is REPLAY_LOCK
+    bool done;                   // no steps left
+} replay_reader_t;
+
+void replay_record_start(replay_record_t *record, unsigned int seed);
+void replay_record_step(replay_record_t *record, unsigned int frame, unsigned int input, const game_state_t *game,
+                        unsigned int events);
+unsigned int replay_board_hash(const game_state_t *game);
+unsigned int replay_lock_hash(const game_state_t *game);
+void replay_reader_init(replay_reader_t *reader, const unsigned char *bytes, unsigned int length);
+bool replay_key_step(replay_reader_t *reader, unsigned int frame, unsigned int *input);
+unsigned int replay_frame_step(replay_reader_t *reader, unsigned int frame);
+bool replay_check_step(replay_reader_t *reader, const game_state_t *game, unsigned int events);
+
+#endif
@@ -0,0 +1,31 @@
+// game record for the no-input benchmark of main.c (REPLAY_BENCH); written by tetris_replay -c
+#ifndef __REPLAY_BENCH__
+#define __REPLAY_BENCH__
+
+const unsigned int replay_bench_seed = 0xBD0BC5FE;
+const unsigned int replay_bench_length = 324;
+const unsigned char replay_bench_bytes[324] = {
+    0xC4, 0x1D, 0xC4, 0x21, 0xC4, 0x23, 0xC4, 0x22, 0xC2, 0x02, 0xC4, 0x10, 0xC4, 0x0C, 0xC4, 0x2A, 
+    0xC2, 0x04, 0xC4, 0x22, 0xC2, 0x24, 0xC4, 0x07, 0xC8, 0x04, 0xD8, 0x01, 0xD8, 0x00, 0xD8, 0x00, 
+    0xD8, 0x00, 0xD8, 0x00, 0xC1, 0x12, 0xC4, 0x07, 0xC4, 0x1D, 0xC2, 0x02, 0xC2, 0x1D, 0xC8, 0x45, 
+    0xD8, 0x01, 0x00, 0xB7, 0xD7, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 
+    0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 
+    0x00, 0xC2, 0x14, 0xC4, 0x21, 0xC4, 0x1F, 0xC4, 0x10, 0xC4, 0x11, 0xC2, 0x0D, 0xD0, 0x08, 0x00, 
+    0xF2, 0xC9, 0x44, 0xC4, 0x08, 0xC2, 0x1D, 0xC8, 0x05, 0xD8, 0x01, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 
+    0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xC8, 0x05, 0xD8, 
+    0x01, 0xD8, 0x00, 0xD8, 0x00, 0x00, 0x8F, 0xC9, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 
+    0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 
+    0xC2, 0x14, 0xC2, 0x0A, 0xE0, 0x0A, 0x00, 0xE9, 0x09, 0xC2, 0x09, 0xC2, 0x0F, 0xC2, 0x1A, 0xC8, 
+    0x0B, 0xD8, 0x01, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xC4, 0x1D, 0xC2, 0x1A, 0xC8, 0x1B, 0xD8, 
+    0x01, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0x00, 0xB5, 0x1D, 0xD8, 0x00, 
+    0xD8, 0x00, 0xC2, 0x16, 0xC1, 0x18, 0xC4, 0x16, 0xC2, 0x1E, 0xC4, 0x02, 0xC4, 0x16, 0xC4, 0x13, 
+    0xC2, 0x05, 0xC2, 0x0F, 0xE0, 0x06, 0x00, 0xED, 0x5C, 0xC1, 0x12, 0xE0, 0x0C, 0x00, 0x18, 0xB2, 
+    0xC4, 0x09, 0xC4, 0x11, 0xC4, 0x0A, 0xC2, 0x44, 0xE0, 0x06, 0x00, 0xE1, 0x48, 0xC4, 0x04, 0xC2, 
+    0x1C, 0xC1, 0x12, 0xE0, 0x06, 0x00, 0xA1, 0xA8, 0xC2, 0x18, 0xC2, 0x11, 0xC1, 0x1E, 0xC4, 0x16, 
+    0xE0, 0x1B, 0x00, 0xE4, 0x7A, 0xC1, 0x09, 0xC8, 0x22, 0xD8, 0x01, 0xD8, 0x00, 0xD8, 0x00, 0xE0, 
+    0x0C, 0x00, 0xDB, 0xFB, 0xC4, 0x04, 0xE0, 0x0D, 0x00, 0xA8, 0x57, 0xC4, 0x14, 0xE0, 0x0E, 0x00, 
+    0x46, 0x5E, 0xC4, 0x1D, 0xE0, 0x0C, 0x00, 0x91, 0x05, 0xC1, 0x17, 0xC1, 0x11, 0xC1, 0x01, 0xD0, 
+    0x00, 0x00, 0xBC, 0x2B
+};
+
+#endif
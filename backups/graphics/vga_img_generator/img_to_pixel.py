@@ -7,6 +7,9 @@ DEFAULT_IMG_DIR_I = 'input_img/'
 DEFAULT_IMG_DIR_O = 'output_img/'
 DEFAULT_IMG_INPUT = 'Tetris_Board_Color'
 DEFAULT_IMG_OUTPUT = 'new_img'
+DEFAULT_FORMAT = 'rle'
+RUN_BYTE_BITS = 8
+PALETTE_SIZE = 16 # palette entries of vga_top; game_ram holds 4-bit palette indexes
 
 def get_args():
     parser = argparse.ArgumentParser(
@@ -32,6 +35,25 @@ def get_args():
         default=DEFAULT_IMG_DIR_I,
         help='location of img: path/to/img/outer_dir/'
     )
+    parser.add_argument(
+        '-f', '--format',
+        type=str,
+        choices=['rle', 'raw'],
+        default=DEFAULT_FORMAT,
+        help='rle: palette + run-length-encoded rows (rle_image_t in img.h); raw: one 12-bit color per pixel'
+    )
+    parser.add_argument(
+        '-n', '--name',
+        type=str,
+        default='img',
+        help='name of the image in C'
+    )
+    parser.add_argument(
+        '-k', '--keep',
+        type=lambda colors: [int(color, 16) for color in colors.split(',')],
+        default=[],
+        help='12-bit colors that are never merged, e.g. colors that blink by rewriting their palette entry: 0x0,0xe12'
+    )
     parser.add_argument(
         '-d', '--debug',
         type=bool,
@@ -40,7 +62,7 @@ def get_args():
     )
 
     result = parser.parse_args()
-    return result.img_name_input, result.img_name_output, result.path, result.debug
+    return result.img_name_input, result.img_name_output, result.path, result.format, result.name, result.keep, result.debug
 
 def config_log():
     # create logger
@@ -65,8 +87,83 @@ def config_log():
 
     return logger
 
+def c_list(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ', '.join(values[i:i + per_line]))
+    return ',\n'.join(lines)
+
+def reduce_colors(pixels, max_colors, keep):
+    """
+    merges colors until the image has at most max_colors; each step folds the color that costs the least
+    (pixels * squared distance) into its closest color. Colors in keep are never merged away or merged into
+    """
+    counts = {}
+    for row in pixels:
+        for color in row:
+            counts[color] = counts.get(color, 0) + 1
+
+    def distance(a, b):
+        return sum(((a >> shift & 0xF) - (b >> shift & 0xF)) ** 2 for shift in (8, 4, 0))
+
+    merged = {}
+    while len(counts) > max_colors:
+        cost, color, closest = min(
+            (counts[color] * distance(color, other), color, other)
+            for color in counts if color not in keep
+            for other in counts if other != color and other not in keep
+        )
+        counts[closest] += counts.pop(color)
+        merged[color] = closest
+        for old, new in merged.items():
+            if new == color:
+                merged[old] = closest
+
+    return [[merged.get(color, color) for color in row] for row in pixels]
+
+def rle_encode(pixels, name):
+    """
+    encodes rows of 12-bit colors as an rle_image_t (see applications/src/img.h)
+    palette: every color of the image, most used first
+    runs: one byte per run, (palette index << run_bits) | (run length - 1); runs never cross a row
+    rows: index of the first run of each row so a single pixel can be looked up without decoding the image
+    """
+    counts = {}
+    for row in pixels:
+        for color in row:
+            counts[color] = counts.get(color, 0) + 1
+    palette = sorted(counts, key=lambda color: -counts[color])
+
+    index_bits = max(1, (len(palette) - 1).bit_length())
+    run_bits = RUN_BYTE_BITS - index_bits
+    if run_bits < 1:
+        raise ValueError(f'{name} has {len(palette)} colors; a run byte holds at most {1 << (RUN_BYTE_BITS - 1)}')
+    max_run = 1 << run_bits
+
+    runs = []
+    rows = []
+    for row in pixels:
+        rows.append(len(runs))
+        col = 0
+        while col < len(row):
+            length = 1
+            while col + length < len(row) and row[col + length] == row[col] and length < max_run:
+                length += 1
+            runs.append((palette.index(row[col]) << run_bits) | (length - 1))
+            col += length
+
+    string = f'// {name}: {len(pixels[0])}x{len(pixels)}, {len(palette)} colors, {len(runs)} runs; generated by img_to_pixel.py\n'
+    string += f'const unsigned short int {name}_palette[{len(palette)}] = {{\n'
+    string += c_list([hex(color) for color in palette]) + '\n};\n'
+    string += f'const unsigned short int {name}_rows[{len(rows)}] = {{\n'
+    string += c_list([str(offset) for offset in rows]) + '\n};\n'
+    string += f'const unsigned char {name}_runs[{len(runs)}] = {{\n'
+    string += c_list([hex(run) for run in runs]) + '\n};\n'
+    string += f'const rle_image_t {name} = {{{name}_palette, {len(palette)}, {name}_rows, {name}_runs, {run_bits}}};\n'
+    return string
+
 def main():
-    input_name, output_name, path, debug = get_args()
+    input_name, output_name, path, output_format, name, keep, debug = get_args()
     log = config_log()
 
     img = Image.open(path+input_name+'.png')
@@ -99,14 +196,16 @@ def main():
             pix_array[j, i] = (0x0, 0x0, 0x0)
 
     new_pixel = np.zeros((height, width, 3), dtype=np.uint8)
+    pixels = []
 
     with open('array_in_C.txt', 'w') as file:
         string = ''
-        string += f'unsigned short int img[{height}][{width}] = {{\n'
+        string += f'unsigned short int {name}[{height}][{width}] = {{\n'
 
         debug_str = string
 
         for row in range(0, height):
+            pixels.append([])
             string += '\t{'
             for col in range(0, width):
                 r, g, b = pix_array[col, row]
@@ -115,6 +214,7 @@ def main():
 
                 debug_str += f'({r},{g},{b}), '  # decimal 
                 hex_value = (r << 8) + (g << 4) + b
+                pixels[row].append(hex_value)
                 string += f'{hex(hex_value)}, '
 
             string = string[:-2] + '}, \n'
@@ -123,6 +223,9 @@ def main():
         string = string[:-3] + '\n};'
         debug_str = debug_str[:-3] + '\n};'
 
+        if output_format == 'rle':
+            string = rle_encode(reduce_colors(pixels, PALETTE_SIZE, keep), name)
+
         file.write(string)
         if (debug):
             log.debug(debug_str)     
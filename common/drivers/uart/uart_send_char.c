@@ -26,7 +26,8 @@
 #ifdef CUSTOM_UART
 /*-----------------------------------------------------------*/
 // Minimalistic UART send char implementation
-void uart_send_char(char c)
+// Weak so an application can replace the busy wait with an interrupt driven transmit buffer
+void __attribute__((weak)) uart_send_char(char c)
 {
    while (UART_TX_BUSY());                   // Wait for TX to be available
 
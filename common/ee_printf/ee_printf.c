@@ -568,9 +568,10 @@ int ee_sprintf(char *buf, const char *fmt, ...)
 char ee_printfBuff[EE_PRINTF_BUFF_SIZE_BYTES];
 volatile char *ee_printfBuffPtr = ee_printfBuff;
 
-void uart_send_char(char c) {
+void __attribute__((weak)) uart_send_char(char c) {
   // This version is for systems without semi-hosting and without a UART either.
   // Print our text into a circular buffer so it can be viewed with a memory dump.
+  // Weak so an application with its own UART output (an interrupt driven one) replaces it.
   *ee_printfBuffPtr++ = c;
   if (ee_printfBuffPtr >= ee_printfBuff + EE_PRINTF_BUFF_SIZE_BYTES)
     ee_printfBuffPtr = ee_printfBuff;
@@ -25,6 +25,8 @@ module PS2Receiver
     input kclk, // ps2 clk
     input kdata, // ps2 data
     output [31:0] keycodeout, // keycode
+    output [7:0] scancodeout, // every byte received, repeats included; valid while scancode_strobe is high
+    output scancode_strobe,   // one wishbone clock pulse for each byte received
 	
 	//**********************wishbone interface************************
 	input    wire         wb_clk_i,	// Clock
@@ -47,11 +49,13 @@ module PS2Receiver
 	reg [3:0]cnt;		// keep track of the count of bits and have it stop at 8
 	reg [31:0]keycode;  // register to keep 
 	reg flag;			// flag
+	reg [2:0]flag_sync;	// flag synchronized to the wishbone clock
 	
 	initial begin
 		keycode[31:0] = 32'h0;
 		cnt<=4'b0000;
 		flag<=1'b0;
+		flag_sync<=3'b000;
 	end
 
 	// DEBOUNCE THE BUTTONS ON THE KEYBOARD
@@ -125,5 +129,15 @@ module PS2Receiver
 				default: wb_dat_o <= 32'b0; // Default case
 			endcase
 	end
+
+	// pulse scancode_strobe once for every byte, when flag rises, for the decoder in keyboard_top
+	assign scancode_strobe = (flag_sync[2:1] == 2'b01);
+
+	always @(posedge wb_clk_i) begin
+		flag_sync <= {flag_sync[1:0], flag};
+	end
+
+	// datacur holds still for a whole PS/2 frame after flag rises, so it is safe to use with scancode_strobe
+	assign scancodeout = datacur;
     
 endmodule
@@ -8,7 +8,9 @@
 // Project Name: Tetris
 // Target Devices: Nexys4DDR
 // Tool Versions: 
-// Description: This module instantiates the PS2Receiver module
+// Description: This module instantiates the PS2Receiver module, decodes make, break
+//              and E0 extended sequences into a bitmap of the game keys held down and
+//              a FIFO of key events, and raises an interrupt while the FIFO is not empty
 // 
 // Dependencies: 
 // 
@@ -36,6 +38,7 @@ module keyboard_top
 	output     [dw-1:0]  wb_dat_o,	// output data bus
 	output           wb_ack_o,	// normal termination
 	output            wb_err_o,	// termination w/ error
+	output            wb_inta_o,	// interrupt request; key events are waiting in the FIFO
 
 	//keyboard interface
     input wire CLK100MHZ,
@@ -49,6 +52,10 @@ module keyboard_top
 	
 	//generate key code
 	wire [31:0] keycode;
+	wire [7:0]  scancode;
+	wire        scancode_strobe;
+	wire [dw-1:0] receiver_dat_o;	// keycode register
+	reg  [dw-1:0] decoder_dat_o;	// key state and key event registers
 	
 	//reduce from 100 MHZ to 50 MHZ
 	always @(posedge(CLK100MHZ))begin
@@ -60,6 +67,8 @@ module keyboard_top
 		.kclk(PS2_CLK),
 		.kdata(PS2_DATA),
 		.keycodeout(keycode[31:0]),
+		.scancodeout(scancode),
+		.scancode_strobe(scancode_strobe),
 	
 		//wishbone interface
 		.wb_clk_i     (wb_clk_i), 
@@ -70,11 +79,113 @@ module keyboard_top
         .wb_sel_i     (wb_sel_i),
         .wb_we_i      (wb_we_i), 
         .wb_stb_i     (wb_stb_i), 
-        .wb_dat_o     (wb_dat_o),
+        .wb_dat_o     (receiver_dat_o),
         .wb_ack_o     (wb_ack_o), 
         .wb_err_o     (wb_err_o)
 	);
-	
-	
+
+	// ********************** make/break decoder **********************
+	// register 2: keys held down; bit n = 1 while the key mapped to bit n is down
+	// register 3: oldest key event, removed from the FIFO when read
+	//             bit 12 = events were lost because the FIFO was full; bit 11 = valid
+	//             bit 10 = repeat (typematic make of a key already held); bit 9 = extended; bit 8 = break; bits 7:0 = scancode
+	localparam EVENT_FIFO_DEPTH = 16;
+
+	reg        break_pending;		// F0 received; the next key byte is a release
+	reg        extended_pending;	// E0 received; the next key byte is an extended key
+	reg [31:0] keys_held;
+	reg [10:0] event_fifo [0:EVENT_FIFO_DEPTH-1];
+	reg [4:0]  event_wr, event_rd;	// one extra bit tells full from empty
+	reg        event_overflow;
+	reg [4:0]  key_index;			// bit of keys_held for the key byte being decoded
+	reg        key_mapped;
+
+	wire event_empty = (event_wr == event_rd);
+	wire event_full  = (event_wr - event_rd) == EVENT_FIFO_DEPTH;
+	wire event_read  = wb_cyc_i & wb_stb_i & !wb_we_i & !wb_ack_o & (wb_adr_i[5:2] == 4'b0011);
+	wire key_byte    = scancode_strobe && scancode != 8'hF0 && scancode != 8'hE0;
+	wire key_repeat  = !break_pending && key_mapped && keys_held[key_index];
+
+	initial begin
+		break_pending = 1'b0;
+		extended_pending = 1'b0;
+		keys_held = 32'h0;
+		event_wr = 5'd0;
+		event_rd = 5'd0;
+		event_overflow = 1'b0;
+	end
+
+	// game keys tracked in keys_held
+	always @(*) begin
+		key_mapped = 1'b1;
+		case ({extended_pending, scancode})
+			9'h01D: key_index = 5'd0;	// W
+			9'h01C: key_index = 5'd1;	// A
+			9'h01B: key_index = 5'd2;	// S
+			9'h023: key_index = 5'd3;	// D
+			9'h05A: key_index = 5'd4;	// enter
+			9'h029: key_index = 5'd5;	// space
+			9'h076: key_index = 5'd6;	// escape
+			9'h04D: key_index = 5'd7;	// P
+			9'h175: key_index = 5'd8;	// up arrow
+			9'h16B: key_index = 5'd9;	// left arrow
+			9'h172: key_index = 5'd10;	// down arrow
+			9'h174: key_index = 5'd11;	// right arrow
+			9'h015: key_index = 5'd12;	// Q
+			9'h024: key_index = 5'd13;	// E
+			default: begin
+				key_index = 5'd0;
+				key_mapped = 1'b0;
+			end
+		endcase
+	end
+
+	// on reset a half decoded F0/E0 prefix, the held keys and the FIFO are all dropped, so nothing from before
+	// the reset comes out as an event after it
+	always @(posedge wb_clk_i) begin
+		if (wb_rst_i) begin
+			break_pending <= 1'b0;
+			extended_pending <= 1'b0;
+			keys_held <= 32'h0;
+			event_wr <= 5'd0;
+			event_rd <= 5'd0;
+			event_overflow <= 1'b0;
+		end else begin
+			if (scancode_strobe && scancode == 8'hF0)
+				break_pending <= 1'b1;
+			else if (scancode_strobe && scancode == 8'hE0)
+				extended_pending <= 1'b1;
+			else if (key_byte) begin
+				if (key_mapped)
+					keys_held[key_index] <= !break_pending;
+				if (!event_full) begin
+					event_fifo[event_wr[3:0]] <= {key_repeat, extended_pending, break_pending, scancode};
+					event_wr <= event_wr + 1;
+				end
+				break_pending <= 1'b0;
+				extended_pending <= 1'b0;
+			end
+
+			if (event_read && !event_empty)
+				event_rd <= event_rd + 1;
+
+			if (key_byte && event_full)
+				event_overflow <= 1'b1;
+			else if (event_read)
+				event_overflow <= 1'b0;
+		end
+	end
+
+	// read the decoder registers; zero for the registers of the receiver
+	always @(posedge wb_clk_i) begin
+		case (wb_adr_i[5:2])
+			4'b0010: decoder_dat_o <= keys_held;
+			4'b0011: decoder_dat_o <= {19'b0, event_overflow, !event_empty, event_fifo[event_rd[3:0]]};
+			default: decoder_dat_o <= 32'b0;
+		endcase
+	end
+
+	assign wb_dat_o  = receiver_dat_o | decoder_dat_o;
+	assign wb_inta_o = !event_empty;
   
 endmodule
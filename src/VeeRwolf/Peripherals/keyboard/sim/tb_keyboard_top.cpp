@@ -0,0 +1,430 @@
+/**
+* Brief:
+* Verilator testbench for keyboard_top (with PS2Receiver and the debouncer under it).
+* A PS/2 device model clocks whole frames (start bit, 8 data bits LSB first, odd parity, stop bit) onto
+* PS2_CLK/PS2_DATA at keyboard speed, and a wishbone bus-functional model reads KEY_STATE_REG (register 2)
+* and KEY_EVENT_REG (register 3) the way main.c does, so every check goes through the RTL from the PS/2 pins on.
+*
+* Scenarios, in order, on one instance of keyboard_top:
+*   make          a key press sets its KEY_STATE bit and queues a make event
+*   typematic     the same make again while held queues events with the repeat bit
+*   break         F0 + key clears the KEY_STATE bit and queues a break event
+*   extended      E0 + key and E0 F0 + key set the extended bit and the state bit of the arrow key
+*   unmapped      a key with no KEY_STATE bit still queues its events but leaves the state alone
+*   overflow      17 events with nobody reading: the first 16 come out, the overflow bit is set on the first
+*                 read and cleared by it, and the interrupt drops once the FIFO is empty
+*   typing        30 keys at 40 keys/s, mapped, unmapped and extended, while the CPU side only drains
+*                 KEY_EVENT_REG once per 60 Hz frame the way the game loop does: every make and break comes
+*                 out in order, none is lost or overflows, and KEY_STATE ends at 0
+*   reset         wb_rst_i in the middle of an F0 or E0 prefix, with keys held and events queued, leaves no
+*                 trace: the next key byte is a plain make, KEY_STATE is 0 and the FIFO is empty
+*
+* Clocks are the ones of the board: CLK100MHZ (halved to 50 MHz for the debouncer) and wb_clk_i at 50 MHz.
+* One tick is 5 ns. PS2_CLK runs at 16.7 kHz, the fastest a keyboard may clock.
+*
+* usage: tb_keyboard_top
+* prints one line per scenario; exits with 1 if any check failed
+**/
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "Vkeyboard_top.h"
+#include "verilated.h"
+
+/** clocks; one tick is 5 ns **/
+#define TICK_NS 5
+#define WB_HALF_PERIOD 2  // 50 MHz; CLK100MHZ toggles every tick
+#define RESET_CYCLES 8
+#define PS2_BIT_NS 60000  // 16.7 kHz PS/2 clock
+#define PS2_GAP_NS 200000 // idle between the bytes of a key
+#define SETTLE_NS 20000   // after a stop bit, for the byte to reach the decoder
+#define FRAME_NS 16666667 // 60 Hz; the game reads KEY_EVENT_REG once per frame
+#define TYPING_KEYS 30
+#define TYPING_KEY_NS 25000000 // 40 keys/s; each key is held for half of it
+
+/** keyboard_top registers; wb_adr_i[5:2] **/
+#define KEY_STATE_REG 2
+#define KEY_EVENT_REG 3
+#define EVENT_BREAK    0x100
+#define EVENT_EXTENDED 0x200
+#define EVENT_REPEAT   0x400
+#define EVENT_VALID    0x800
+#define EVENT_OVERFLOW 0x1000
+#define EVENT_FIFO_DEPTH 16
+
+/** scancodes (set 2) and KEY_STATE bits; see applications/src/keyboard_keys.h **/
+#define BREAK_PREFIX    0xF0
+#define EXTENDED_PREFIX 0xE0
+#define A_KEY     0x1C
+#define D_KEY     0x23
+#define W_KEY     0x1D
+#define T_KEY     0x2C // no KEY_STATE bit
+#define LEFT_KEY  0x6B // extended
+#define KEY_STATE_W    (1 << 0)
+#define KEY_STATE_A    (1 << 1)
+#define KEY_STATE_D    (1 << 3)
+#define KEY_STATE_LEFT (1 << 9)
+
+Vkeyboard_top *top;
+unsigned long long ticks;
+unsigned long failures;
+bool in_bus;                       // a wishbone cycle is open; the frame drain waits for it
+unsigned long long next_drain;     // tick of the next frame drain; 0 = no drain
+unsigned int drained[2 * TYPING_KEYS + 1];
+unsigned int drained_count;
+
+unsigned int read_reg(unsigned int reg);
+
+/**
+ * @brief the game loop side of the typing scenario: reads KEY_EVENT_REG until the FIFO is empty
+ */
+void drain_events() {
+    unsigned int event = 0;
+
+    while ((event = read_reg(KEY_EVENT_REG)) & EVENT_VALID) {
+        if (drained_count < sizeof(drained) / sizeof(drained[0])) {
+            drained[drained_count] = event;
+        }
+        drained_count++;
+    }
+}
+
+/**
+ * @brief advances the simulation by one tick; CLK100MHZ toggles every tick and wb_clk_i every WB_HALF_PERIOD
+ */
+void step() {
+    ticks++;
+    top->CLK100MHZ ^= 1;
+    if (ticks % WB_HALF_PERIOD == 0) {
+        top->wb_clk_i ^= 1;
+    }
+    top->eval();
+
+    if (next_drain != 0 && !in_bus && ticks >= next_drain) {
+        next_drain += FRAME_NS / TICK_NS;
+        drain_events();
+    }
+}
+
+/**
+ * @brief advances the simulation by a time
+ *
+ * @param ns
+ */
+void wait_ns(unsigned long long ns) {
+    unsigned long long end = ticks + ns / TICK_NS;
+
+    while (ticks < end) {
+        step();
+    }
+}
+
+/**
+ * @brief advances to the next rising edge of wb_clk_i
+ */
+void wb_edge() {
+    do {
+        step();
+    } while (!(top->wb_clk_i && ticks % (2 * WB_HALF_PERIOD) == WB_HALF_PERIOD));
+}
+
+/**
+ * @brief holds wb_rst_i for RESET_CYCLES wishbone clocks
+ */
+void reset() {
+    top->wb_rst_i = 1;
+    for (int i = 0; i < RESET_CYCLES; i++) {
+        wb_edge();
+    }
+    top->wb_rst_i = 0;
+    wb_edge();
+}
+
+/**
+ * @brief wishbone read; the strobe is held until keyboard_top acks it
+ *
+ * @param reg  wb_adr_i[5:2]
+ * @return wb_dat_o at the ack
+ */
+unsigned int read_reg(unsigned int reg) {
+    unsigned int value = 0;
+
+    in_bus = true;
+    top->wb_adr_i = reg << 2;
+    top->wb_we_i = 0;
+    top->wb_sel_i = 0xF;
+    top->wb_cyc_i = 1;
+    top->wb_stb_i = 1;
+    do {
+        wb_edge();
+    } while (!top->wb_ack_o);
+    value = top->wb_dat_o;
+
+    top->wb_cyc_i = 0;
+    top->wb_stb_i = 0;
+    wb_edge();
+    in_bus = false;
+    return value;
+}
+
+/**
+ * @brief clocks one byte out of the PS/2 device: data changes while PS2_CLK is high and is taken on the falling edge
+ *
+ * @param byte
+ */
+void send_byte(unsigned char byte) {
+    unsigned int parity = 1;
+    unsigned int frame = 0;
+
+    for (int i = 0; i < 8; i++) {
+        parity ^= (byte >> i) & 1;
+    }
+    // start bit, data LSB first, odd parity, stop bit
+    frame = (1 << 10) | (parity << 9) | (byte << 1);
+
+    for (int bit = 0; bit < 11; bit++) {
+        top->PS2_DATA = (frame >> bit) & 1;
+        wait_ns(PS2_BIT_NS / 4);
+        top->PS2_CLK = 0;
+        wait_ns(PS2_BIT_NS / 2);
+        top->PS2_CLK = 1;
+        wait_ns(PS2_BIT_NS / 4);
+    }
+    top->PS2_DATA = 1;
+    wait_ns(SETTLE_NS);
+}
+
+/**
+ * @brief sends the bytes of one key press or release
+ *
+ * @param extended  E0 first
+ * @param release   F0 before the key
+ * @param scancode
+ */
+void send_key(bool extended, bool release, unsigned char scancode) {
+    if (extended) {
+        send_byte(EXTENDED_PREFIX);
+    }
+    if (release) {
+        send_byte(BREAK_PREFIX);
+    }
+    send_byte(scancode);
+    wait_ns(PS2_GAP_NS);
+}
+
+/**
+ * @brief counts a failed check and prints it
+ *
+ * @param passed
+ * @param format  printf format of what was checked
+ */
+void check(bool passed, const char *format, ...) {
+    va_list args;
+
+    if (passed) {
+        return;
+    }
+    failures++;
+    fprintf(stderr, "FAIL at %llu ns: ", ticks * TICK_NS);
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fprintf(stderr, "\n");
+}
+
+/**
+ * @brief reads KEY_EVENT_REG and checks it holds the expected event
+ *
+ * @param expected  EVENT_* bits and scancode; EVENT_VALID is added
+ */
+void expect_event(unsigned int expected) {
+    unsigned int event = read_reg(KEY_EVENT_REG);
+
+    check(event == (expected | EVENT_VALID), "KEY_EVENT_REG = %03x, expected %03x", event, expected | EVENT_VALID);
+}
+
+/**
+ * @brief reads KEY_EVENT_REG and checks the FIFO is empty
+ */
+void expect_no_event() {
+    unsigned int event = read_reg(KEY_EVENT_REG);
+
+    check(!(event & EVENT_VALID), "KEY_EVENT_REG = %03x, expected no event", event);
+    check(!top->wb_inta_o, "wb_inta_o is up with the event FIFO empty");
+}
+
+/**
+ * @brief reads KEY_STATE_REG and checks it
+ *
+ * @param expected
+ */
+void expect_state(unsigned int expected) {
+    unsigned int state = read_reg(KEY_STATE_REG);
+
+    check(state == expected, "KEY_STATE_REG = %08x, expected %08x", state, expected);
+}
+
+/**
+ * @brief prints the result of a scenario
+ *
+ * @param name
+ * @param failures_before
+ */
+void report(const char *name, unsigned long failures_before) {
+    printf("%-10s %s\n", name, (failures == failures_before) ? "ok" : "FAIL");
+}
+
+int main(int argc, char **argv) {
+    unsigned long before = 0;
+    unsigned int event = 0;
+
+    Verilated::commandArgs(argc, argv);
+    top = new Vkeyboard_top;
+    top->CLK100MHZ = 0;
+    top->wb_clk_i = 0;
+    top->wb_cyc_i = 0;
+    top->wb_stb_i = 0;
+    top->wb_we_i = 0;
+    top->PS2_CLK = 1;
+    top->PS2_DATA = 1;
+    top->eval();
+    reset();
+    wait_ns(PS2_GAP_NS);
+
+    before = failures;
+    expect_state(0);
+    expect_no_event();
+    send_key(false, false, A_KEY);
+    check(top->wb_inta_o, "wb_inta_o is down with an event in the FIFO");
+    expect_state(KEY_STATE_A);
+    expect_event(A_KEY);
+    expect_no_event();
+    report("make", before);
+
+    before = failures;
+    send_key(false, false, A_KEY);
+    send_key(false, false, A_KEY);
+    expect_state(KEY_STATE_A);
+    expect_event(EVENT_REPEAT | A_KEY);
+    expect_event(EVENT_REPEAT | A_KEY);
+    expect_no_event();
+    report("typematic", before);
+
+    before = failures;
+    send_key(false, true, A_KEY);
+    expect_state(0);
+    expect_event(EVENT_BREAK | A_KEY);
+    expect_no_event();
+    report("break", before);
+
+    before = failures;
+    send_key(true, false, LEFT_KEY);
+    expect_state(KEY_STATE_LEFT);
+    send_key(true, false, LEFT_KEY);
+    send_key(true, true, LEFT_KEY);
+    expect_state(0);
+    expect_event(EVENT_EXTENDED | LEFT_KEY);
+    expect_event(EVENT_REPEAT | EVENT_EXTENDED | LEFT_KEY);
+    expect_event(EVENT_BREAK | EVENT_EXTENDED | LEFT_KEY);
+    expect_no_event();
+    report("extended", before);
+
+    before = failures;
+    send_key(false, false, T_KEY);
+    send_key(false, false, T_KEY);
+    send_key(false, true, T_KEY);
+    expect_state(0);
+    expect_event(T_KEY);
+    expect_event(T_KEY);
+    expect_event(EVENT_BREAK | T_KEY);
+    expect_no_event();
+    report("unmapped", before);
+
+    // 8 presses and releases of D, then a 17th event that finds the FIFO full
+    before = failures;
+    for (int i = 0; i < EVENT_FIFO_DEPTH / 2; i++) {
+        send_key(false, false, D_KEY);
+        send_key(false, true, D_KEY);
+    }
+    send_key(false, false, W_KEY);
+    event = read_reg(KEY_EVENT_REG);
+    check(event == (EVENT_OVERFLOW | EVENT_VALID | D_KEY), "first read after the overflow: KEY_EVENT_REG = %04x", event);
+    event = read_reg(KEY_EVENT_REG);
+    check(event == (EVENT_VALID | EVENT_BREAK | D_KEY), "second read after the overflow: KEY_EVENT_REG = %04x", event);
+    for (int i = 1; i < EVENT_FIFO_DEPTH / 2; i++) {
+        expect_event(D_KEY);
+        expect_event(EVENT_BREAK | D_KEY);
+    }
+    expect_no_event();
+    expect_state(KEY_STATE_W); // the state still follows the keys the FIFO had no room for
+    send_key(false, true, W_KEY);
+    expect_event(EVENT_BREAK | W_KEY);
+    report("overflow", before);
+
+    // key i starts at i * TYPING_KEY_NS and is released half way; the keys cycle through A, W, D, LEFT (E0) and
+    // T (no KEY_STATE bit). The frame drain runs from step(), so it also lands in the middle of PS/2 bytes
+    before = failures;
+    {
+        const unsigned char codes[] = {A_KEY, D_KEY, T_KEY, W_KEY, LEFT_KEY};
+        unsigned int expected[2 * TYPING_KEYS];
+        unsigned long long start = 0;
+
+        drained_count = 0;
+        next_drain = ticks + FRAME_NS / TICK_NS;
+        for (int i = 0; i < TYPING_KEYS; i++) {
+            unsigned char code = codes[(i * 3) % 5];
+            bool extended = (code == LEFT_KEY);
+            unsigned int bits = (extended ? EVENT_EXTENDED : 0) | code;
+
+            expected[2 * i] = EVENT_VALID | bits;
+            expected[2 * i + 1] = EVENT_VALID | EVENT_BREAK | bits;
+            start = ticks;
+            send_key(extended, false, code);
+            wait_ns(TYPING_KEY_NS / 2 - (ticks - start) * TICK_NS);
+            send_key(extended, true, code);
+            wait_ns(TYPING_KEY_NS - (ticks - start) * TICK_NS);
+        }
+        wait_ns(FRAME_NS);
+        next_drain = 0;
+
+        check(drained_count == 2 * TYPING_KEYS, "%u events drained, expected %u", drained_count, 2 * TYPING_KEYS);
+        for (unsigned int i = 0; i < drained_count && i < 2 * TYPING_KEYS; i++) {
+            check(drained[i] == expected[i], "event %u: KEY_EVENT_REG = %04x, expected %04x", i, drained[i], expected[i]);
+        }
+    }
+    expect_no_event();
+    expect_state(0);
+    report("typing", before);
+
+    // reset after F0: the next key is a make
+    before = failures;
+    send_key(false, false, A_KEY);
+    send_byte(BREAK_PREFIX);
+    reset();
+    expect_state(0);
+    expect_no_event();
+    send_key(false, false, A_KEY);
+    expect_state(KEY_STATE_A);
+    expect_event(A_KEY);
+    // reset after E0 with keys held and an event queued: all of it goes, and the next key is not extended
+    // (6B without E0 is keypad 4, which has no KEY_STATE bit)
+    send_key(false, false, D_KEY);
+    send_byte(EXTENDED_PREFIX);
+    reset();
+    expect_state(0);
+    expect_no_event();
+    send_key(false, false, LEFT_KEY);
+    expect_state(0);
+    expect_event(LEFT_KEY);
+    expect_no_event();
+    report("reset", before);
+
+    top->final();
+    delete top;
+
+    if (failures != 0) {
+        fprintf(stderr, "%lu checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
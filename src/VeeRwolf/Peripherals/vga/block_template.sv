@@ -0,0 +1,25 @@
+/*
+brief: hard coded 8x8 tetris block; play_area_tiles expands every tile of the play area through it
+each pixel is 2 bits: 00 = block color, 01 = black outline, 10 = white highlight
+The template came with the BLOCK_REG engine, which drew a whole block into game_ram from one write; the tile map
+replaced that engine and BLOCK_REG is gone
+*/
+
+module block_template(
+    input [2:0] rownum,
+    output reg [15:0] pixels // pixels[15:14] is the leftmost pixel
+);
+
+always @(*)
+  case (rownum) // rownum selects the row of the block to give back
+    3'b000: pixels = 16'b01_01_01_01_01_01_01_01;
+    3'b001: pixels = 16'b01_10_10_00_00_00_00_01;
+    3'b010: pixels = 16'b01_10_01_01_01_01_00_01;
+    3'b011: pixels = 16'b01_00_01_10_10_01_00_01;
+    3'b100: pixels = 16'b01_00_01_10_10_01_00_01;
+    3'b101: pixels = 16'b01_00_01_01_01_01_00_01;
+    3'b110: pixels = 16'b01_00_00_00_00_00_00_01;
+    3'b111: pixels = 16'b01_01_01_01_01_01_01_01;
+    default: pixels = 16'b0;
+  endcase
+endmodule
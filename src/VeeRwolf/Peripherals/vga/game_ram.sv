@@ -5,7 +5,10 @@
 @version: 2
 
 @brief:
-RAM that holds the 160x144 pixel screen of the Tetris game
+RAM that holds two pages of the 160x144 pixel screen of the Tetris game; each pixel is an index into the palette
+of vga_top. The CPU writes one page while the VGA reads the other, so a screen can be drawn off-screen.
+During a game the play area is drawn from the tile map of play_area_tiles, but its pixels here are not left out:
+the main menu streams a whole 160x144 image into the page, play area included
 */
 
 `default_nettype wire
@@ -15,19 +18,24 @@ module game_ram(
     input wire vga_clk,
     input wire wb_clk_i,
     input wire wb_rst_i,
+    input wire cpu_page,
+    input wire vga_page,
     input reg  [9:0]  cpu_row_position,
     input reg  [9:0]  cpu_col_position,
-    input reg  [11:0] cpu_rgb_value,
+    input reg  [`COLOR_INDEX_BITS-1:0] cpu_color_index,
     input reg  [11:0] vga_row_position,
     input reg  [11:0] vga_col_position,
     input reg vga_on_screen,
     input reg vga_on_game_screen,
-    output reg [11:0] current_pixel_color
+    output reg [`COLOR_INDEX_BITS-1:0] current_color_index
 );
 
 // Define memory depth and width
-localparam MEM_DEPTH = `RAM_WIDTH * `RAM_HEIGHT; 
-localparam MEM_WIDTH = 12; // rgb color value; r = [11:8], g = [7:4], b = [3:0]
+localparam PAGE_DEPTH = `RAM_WIDTH * `RAM_HEIGHT;
+localparam MEM_DEPTH = PAGE_DEPTH * `NUM_OF_PAGES;
+// palette index; a page is 92,160 bits, a third of the 276,480 of one 12-bit page, but the two pages
+// take 184,320 bits, two thirds of the single 12-bit page the screen used to have
+localparam MEM_WIDTH = `COLOR_INDEX_BITS;
 
 // ram object
 reg [MEM_WIDTH-1:0] ram [MEM_DEPTH-1:0];
@@ -35,20 +43,31 @@ reg [MEM_WIDTH-1:0] ram [MEM_DEPTH-1:0];
 // write to RAM
 always @(posedge wb_clk_i) begin
     if (cpu_row_position < `RAM_HEIGHT && cpu_col_position < `RAM_WIDTH)
-        ram[cpu_row_position*`RAM_WIDTH + cpu_col_position] <= cpu_rgb_value;
-    else
-        cpu_rgb_value <= cpu_rgb_value;
+        ram[cpu_page*PAGE_DEPTH + cpu_row_position*`RAM_WIDTH + cpu_col_position] <= cpu_color_index;
 end
 
 // read data from buffer for display
 always @(posedge vga_clk) begin
     if (vga_on_screen && vga_on_game_screen)
-        current_pixel_color <= ram[
+        current_color_index <= ram[
+            vga_page*PAGE_DEPTH +
             ((vga_row_position - `GAME_COORDINATE_ROW) / `NEW_PIXEL_SIZE)*`RAM_WIDTH + 
             ((vga_col_position - `GAME_COORDINATE_COL) / `NEW_PIXEL_SIZE)
         ];
     else
-        current_pixel_color <= 12'h000;
+        current_color_index <= '0;
+end
+
+`ifndef SYNTHESIS
+// simulation check on the page the read address is built from: every pixel of a frame comes from the page
+// that was there at row 0
+reg frame_page;
+always @(posedge vga_clk) begin
+    if (vga_row_position == 0 && vga_col_position == 0)
+        frame_page <= vga_page;
+    else if (vga_on_screen && vga_on_game_screen && vga_page != frame_page)
+        $error("frame at row %0d col %0d mixes game_ram pages", vga_row_position, vga_col_position);
 end
+`endif
 
 endmodule
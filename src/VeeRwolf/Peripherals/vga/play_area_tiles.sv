@@ -0,0 +1,196 @@
+/*
+@file: play_area_tiles.sv
+@version: 1
+
+@brief:
+Tile map of the 10x18 block play area. Each cell holds a tile id instead of 64 pixels; the VGA read path
+expands the id into an 8x8 block on the fly using the block template.
+tile ids: 0 = empty (white), 1-7 = I, J, L, O, S, T, Z tetris block, 8 = line clear blink (gray)
+After a line clear the row shift engine moves every row above a cleared band down by the size of the band,
+one tile per clock, and fills the rows it uncovers at the top with empty tiles. It only moves tiles while
+shift_enable is high (the vertical blank), so a frame never shows the map half shifted; a shift asked for during
+a frame waits for the next blank. 180 tiles take 180 clocks, far less than one vertical blank.
+Rows set in flash_rows are drawn gray no matter what tiles they hold (line clear blink).
+The falling shape is not in the tile map: it is overlaid on the tiles from the piece register (shape, orientation
+and the board position of its 4x4 box), so moving or rotating it is a single write. The register is taken over in
+the vertical blank so a frame never shows the shape in two places.
+The ghost shape (where the falling shape would land) comes from the same register: the same mask in the same col at
+the ghost row, drawn on empty tiles as a block outline in the color of the shape.
+*/
+
+`default_nettype wire
+`include "game_defines.svh"
+
+module play_area_tiles(
+    input wire vga_clk,
+    input wire wb_clk_i,
+    input wire wb_rst_i,
+    input wire tile_we,
+    input wire [4:0]  tile_row,   // 0-17
+    input wire [3:0]  tile_col,   // 0-9
+    input wire [3:0]  tile_id,
+    input wire shift_start,
+    input wire [4:0]  shift_row,   // bottom row of the cleared band
+    input wire [2:0]  shift_count, // rows in the cleared band
+    input wire shift_enable,       // vertical blank, in the wishbone clock domain
+    output reg shift_busy,
+    input wire [`PLAY_AREA_BLOCKS_TALL-1:0] flash_rows,
+    input wire [31:0] piece,      // vga_top piece register (wishbone clock); see main.c PIECE_REG
+    input reg  [11:0] vga_row_position,
+    input reg  [11:0] vga_col_position,
+    output reg on_play_area,
+    output reg [11:0] tile_pixel_color
+);
+
+localparam NUM_OF_TILES = `PLAY_AREA_BLOCKS_WIDE * `PLAY_AREA_BLOCKS_TALL;
+
+// tile map object
+reg [3:0] tiles [NUM_OF_TILES-1:0];
+
+// position of the VGA scan inside the 160x144 game screen
+wire [11:0] game_row = (vga_row_position - `GAME_COORDINATE_ROW) / `NEW_PIXEL_SIZE;
+wire [11:0] game_col = (vga_col_position - `GAME_COORDINATE_COL) / `NEW_PIXEL_SIZE;
+wire [11:0] play_row = game_row - `PLAY_AREA_ROW;
+wire [11:0] play_col = game_col - `PLAY_AREA_COL;
+
+wire in_play_area = (
+    (`GAME_COORDINATE_ROW <= vga_row_position && vga_row_position < `GAME_COORDINATE_ROW + `GAME_HEIGHT) &&
+    (`GAME_COORDINATE_COL <= vga_col_position && vga_col_position < `GAME_COORDINATE_COL + `GAME_WIDTH) &&
+    (play_row < `PLAY_AREA_BLOCKS_TALL * `BLOCK_PIXELS) &&
+    (play_col < `PLAY_AREA_BLOCKS_WIDE * `BLOCK_PIXELS)
+);
+
+// row shift engine; walks the tile map from the bottom of the band up to tile 0
+reg [7:0] shift_index;
+reg [7:0] shift_offset; // shift_count rows worth of tiles
+
+reg [3:0]  current_tile;
+reg [11:0] current_tile_color;
+reg [15:0] template_row;
+reg [1:0]  template_pixel;
+
+// falling shape overlay
+reg  [31:0] piece_meta, piece_sync; // piece into the vga_clk domain
+reg  [31:0] piece_shown;            // piece drawn in this frame
+wire [15:0] piece_mask;
+wire [4:0]  block_row = play_row / `BLOCK_PIXELS;
+wire [3:0]  block_col = play_col / `BLOCK_PIXELS;
+// block being scanned inside the 4x4 box of the shape; the box position is two's complement, so blocks above
+// or left of the box wrap around to large values
+wire [5:0]  box_row = {1'b0, block_row} - piece_shown[29:24];
+wire [5:0]  box_col = {2'b0, block_col} - {piece_shown[20], piece_shown[20:16]};
+wire on_piece = piece_shown[31] && box_row < 4 && box_col < 4 && piece_mask[{box_row[1:0], box_col[1:0]}];
+wire [5:0]  ghost_box_row = {1'b0, block_row} - piece_shown[15:10];
+wire on_ghost = piece_shown[30] && ghost_box_row < 4 && box_col < 4 && piece_mask[{ghost_box_row[1:0], box_col[1:0]}];
+wire [3:0]  map_tile = tiles[block_row*`PLAY_AREA_BLOCKS_WIDE + block_col];
+reg         draw_ghost;
+
+initial begin
+    for (int i = 0; i < NUM_OF_TILES; i++)
+        tiles[i] = '0;
+end
+
+initial begin
+    piece_meta <= '0;
+    piece_sync <= '0;
+    piece_shown <= '0;
+end
+
+initial begin
+    shift_busy <= '0;
+    shift_index <= '0;
+    shift_offset <= '0;
+end
+
+// start a row shift; vga_top holds off CPU writes while the engine is busy
+always @(posedge wb_clk_i, posedge wb_rst_i) begin
+    if (wb_rst_i) begin
+        shift_busy <= '0;
+        shift_index <= '0;
+        shift_offset <= '0;
+    end
+    else if (shift_start && shift_row < `PLAY_AREA_BLOCKS_TALL) begin
+        shift_busy <= 1'b1;
+        shift_index <= shift_row*`PLAY_AREA_BLOCKS_WIDE + `PLAY_AREA_BLOCKS_WIDE - 1;
+        shift_offset <= shift_count*`PLAY_AREA_BLOCKS_WIDE;
+    end
+    else if (shift_busy && shift_enable) begin
+        shift_index <= shift_index - 1;
+        shift_busy <= (shift_index != 0);
+    end
+end
+
+// write to tile map; the tile moved down is always read from above the one being written
+always @(posedge wb_clk_i) begin
+    if (shift_busy && shift_enable)
+        tiles[shift_index] <= (shift_index >= shift_offset) ? tiles[shift_index - shift_offset] : `EMPTY_TILE;
+    else if (tile_we && tile_row < `PLAY_AREA_BLOCKS_TALL && tile_col < `PLAY_AREA_BLOCKS_WIDE)
+        tiles[tile_row*`PLAY_AREA_BLOCKS_WIDE + tile_col] <= tile_id;
+end
+
+// return the outline/highlight pattern of the block row being scanned
+block_template get_tile_template(
+    .rownum (play_row[2:0]),
+    .pixels (template_row)
+);
+
+// blocks of the falling shape
+tetromino_masks get_piece_mask(
+    .shape       (piece_shown[2:0]),
+    .orientation (piece_shown[9:8]),
+    .mask        (piece_mask)
+);
+
+// take the piece over at the start of the vertical blank, once it has been the same for two clocks
+always @(posedge vga_clk) begin
+    piece_meta <= piece;
+    piece_sync <= piece_meta;
+    if (vga_row_position == `VGA_VERT_PIXELS && vga_col_position == 0 && piece_sync == piece_meta)
+        piece_shown <= piece_sync;
+end
+
+always @(*) begin
+    draw_ghost = 1'b0;
+    if (on_piece)
+        current_tile = piece_shown[2:0] + 1;
+    else if (on_ghost && map_tile == `EMPTY_TILE) begin
+        current_tile = piece_shown[2:0] + 1;
+        draw_ghost = 1'b1;
+    end
+    else
+        current_tile = map_tile;
+    template_pixel = template_row[(7 - play_col[2:0])*2 +: 2];
+
+    case (current_tile)
+        `I_BLOCK + 1: current_tile_color = `CYAN;
+        `J_BLOCK + 1: current_tile_color = `BLUE;
+        `L_BLOCK + 1: current_tile_color = `ORANGE;
+        `O_BLOCK + 1: current_tile_color = `YELLOW;
+        `S_BLOCK + 1: current_tile_color = `GREEN;
+        `T_BLOCK + 1: current_tile_color = `PURPLE;
+        `Z_BLOCK + 1: current_tile_color = `RED;
+        `GRAY_TILE:   current_tile_color = `GRAY;
+        default:      current_tile_color = `WHITE;
+    endcase
+end
+
+// read tile for display; same one clock latency as game_ram
+always @(posedge vga_clk) begin
+    on_play_area <= in_play_area;
+
+    if (flash_rows[play_row / `BLOCK_PIXELS])
+        tile_pixel_color <= `GRAY;
+    else if (current_tile == `EMPTY_TILE || current_tile == `GRAY_TILE)
+        tile_pixel_color <= current_tile_color;
+    else if (draw_ghost)
+        tile_pixel_color <= (template_pixel == `TEMPLATE_OUTLINE) ? current_tile_color : `WHITE;
+    else begin
+        case (template_pixel)
+            `TEMPLATE_OUTLINE:   tile_pixel_color <= `BLACK;
+            `TEMPLATE_HIGHLIGHT: tile_pixel_color <= `WHITE;
+            default:             tile_pixel_color <= current_tile_color;
+        endcase
+    end
+end
+
+endmodule
@@ -0,0 +1,409 @@
+/**
+* Brief:
+* Verilator testbench for vga_top (with the dtg, game_ram, play area tile map and the RTL sections under it).
+* A wishbone bus-functional model replays a trace of the vga_top accesses main.c made, recorded by the
+* host emulator (applications/host, tetris_emulator -t trace). Each access is held on the bus until vga_top
+* acks it, so the bus cycles and the stalls behind the row shift engine come from the RTL itself.
+* The VGA output is sampled back down to the 160x144 game screen, so the frames can be compared with the
+* PPM images of the emulator.
+*
+* Clocks are the ones of the board: wb_clk_i is the 50 MHz core clock and vga_clk is 40 MHz (800x600 @ 60 Hz).
+* Accesses are issued at the core clock they were recorded at (shifted so the first one is at cycle 0), or
+* back-to-back with -f. An access that cannot start on time because the one before it is still on the bus
+* starts late; the late cycles are reported too.
+*
+* The simulation checks of the RTL are built in (--assert, see the Makefile): game_ram stops the run with an
+* error if the page its read address is built from changes between row 0 and the end of a frame.
+* With -m every PAGE_REG write of the trace is held until the VGA is half way down the visible rows, so each page
+* flip is requested mid-frame; the check then shows whether vga_top still waits for the vertical blank to flip.
+*
+* With -c the screen the trace leaves behind is compared pixel for pixel with a PPM image of the emulator,
+* normally the last frame it saved for the same trace. That covers what the emulator draws on its own side:
+* the tile template of every block, the falling shape and its ghost, the digits and the next shape sprite.
+* This comparison has not been run yet: there was no Verilator where it was written.
+* Frames in the middle of the trace are not compared: the RTL frame (1056x628 vga clocks) is a little shorter
+* than the frame the emulator counts (TICKS_PER_FRAME core clocks), so the two drift apart.
+*
+* usage: tb_vga_top [-f] [-m] [-n frames] [-p ppm_dir] [-e every_nth_frame] [-c reference_ppm] trace
+* prints one CSV line per VGA frame: frame,writes,reads,bus_cycles,stall_cycles,late_cycles
+* exits with 1 if a simulation check of the RTL failed or the last screen differs from the -c image
+**/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "Vvga_top.h"
+#include "verilated.h"
+
+/** clocks; one tick is 2.5 ns **/
+#define WB_HALF_PERIOD  4 // 50 MHz
+#define VGA_HALF_PERIOD 5 // 40 MHz
+#define RESET_CYCLES 8
+
+/** wishbone **/
+#define PAGE_REG 14
+#define ACK_CYCLES 2 // vga_top acks a cycle after the strobe, the master sees the ack the cycle after that
+
+/** dtg timing and the game screen inside it (game_defines.svh) **/
+#define HCNT 1056
+#define VCNT 628
+#define VERT_PIXELS 600
+#define VIDEO_LATENCY 2 // vga clocks from the dtg counters to vga_r/g/b
+#define MID_FRAME_ROW (VERT_PIXELS / 2) // row -m holds PAGE_REG writes for
+#define GAME_COORDINATE_ROW 12
+#define GAME_COORDINATE_COL 80
+#define NEW_PIXEL_SIZE 4
+#define SCREEN_WIDTH  160
+#define SCREEN_HEIGHT 144
+#define MAX_PIXELS_LISTED 10 // differing pixels printed by -c
+
+typedef struct trace_access {
+    unsigned long long cycle;
+    bool write;
+    unsigned int reg;   // wb_adr_i[5:2]
+    unsigned int value;
+} trace_access_t;
+
+typedef struct bus_stats {
+    unsigned long writes;
+    unsigned long reads;
+    unsigned long long bus_cycles;   // from the strobe to the ack, for every access
+    unsigned long long stall_cycles; // bus cycles over ACK_CYCLES; writes held off by the engines
+    unsigned long long late_cycles;  // accesses that started after their recorded cycle
+} bus_stats_t;
+
+Vvga_top *top;
+FILE *trace;
+bool back_to_back = false;
+bool mid_frame_pages = false;
+unsigned long max_frames = 0; // 0 = until the trace is done
+unsigned long capture_every = 1;
+const char *ppm_dir = NULL;
+const char *reference_ppm = NULL;
+
+/** bus-functional model **/
+trace_access_t current_access;
+bool access_pending = false; // current_access holds the next trace line
+bool bus_active = false;     // current_access is on the bus
+bool trace_done = false;
+unsigned long long trace_base;
+unsigned long long wb_cycle;
+unsigned long long issue_cycle;
+unsigned long long idle_frame_start; // VGA frame in which the trace was done
+bus_stats_t stats, total;
+
+/** video **/
+unsigned long long vga_clocks; // vga clocks out of reset
+unsigned int vga_row;          // row the dtg counters are on
+unsigned long mid_frame_page_writes;
+unsigned char screen[SCREEN_HEIGHT][SCREEN_WIDTH][3];
+
+/**
+ * @brief reads the next trace line into current_access
+ *
+ * @return false at the end of the trace
+ */
+bool next_access() {
+    char line[128];
+    char kind = 0;
+
+    while (fgets(line, sizeof(line), trace) != NULL) {
+        current_access.value = 0;
+        if (sscanf(line, "%llu %c %u %x", &current_access.cycle, &kind, &current_access.reg, &current_access.value) >= 3) {
+            current_access.write = (kind == 'w');
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief one rising edge of wb_clk_i for the bus-functional model
+ *
+ * @param ack  wb_ack_o just before the edge
+ */
+void bus_edge(bool ack) {
+    wb_cycle++;
+
+    // the access finishes at the edge the ack is seen
+    if (bus_active && ack) {
+        unsigned long long cycles = wb_cycle - issue_cycle;
+
+        stats.bus_cycles += cycles;
+        stats.stall_cycles += cycles - ACK_CYCLES;
+        if (current_access.write) {
+            stats.writes++;
+        }
+        else {
+            stats.reads++;
+        }
+
+        top->wb_cyc_i = 0;
+        top->wb_stb_i = 0;
+        top->wb_we_i = 0;
+        bus_active = false;
+        access_pending = false;
+    }
+
+    if (!access_pending && !trace_done) {
+        access_pending = next_access();
+        trace_done = !access_pending;
+    }
+
+    if (access_pending && !bus_active) {
+        unsigned long long due = current_access.cycle - trace_base;
+        bool held = mid_frame_pages && current_access.write && current_access.reg == PAGE_REG &&
+                    vga_row != MID_FRAME_ROW;
+
+        if ((back_to_back || wb_cycle >= due) && !held) {
+            if (mid_frame_pages && current_access.write && current_access.reg == PAGE_REG) {
+                mid_frame_page_writes++;
+            }
+            if (!back_to_back) {
+                stats.late_cycles += wb_cycle - due;
+            }
+            top->wb_adr_i = current_access.reg << 2;
+            top->wb_dat_i = current_access.value;
+            top->wb_we_i = current_access.write;
+            top->wb_cyc_i = 1;
+            top->wb_stb_i = 1;
+            issue_cycle = wb_cycle;
+            bus_active = true;
+        }
+    }
+}
+
+/**
+ * @brief writes the game screen as a binary PPM, the same format as the host emulator
+ *
+ * @param frame
+ */
+void save_frame(unsigned long long frame) {
+    char path[1024];
+    FILE *file = NULL;
+
+    snprintf(path, sizeof(path), "%s/frame_%05llu.ppm", ppm_dir, frame);
+    file = fopen(path, "wb");
+    if (file == NULL) {
+        perror(path);
+        exit(1);
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    fwrite(screen, 1, sizeof(screen), file);
+    fclose(file);
+}
+
+/**
+ * @brief compares the last screen scanned out with a PPM image of the emulator and prints the pixels that differ
+ *
+ * @param path
+ * @return number of pixels that differ; -1 if the image can not be read
+ */
+long compare_frame(const char *path) {
+    static unsigned char reference[SCREEN_HEIGHT][SCREEN_WIDTH][3];
+    FILE *file = fopen(path, "rb");
+    int width = 0;
+    int height = 0;
+    int max_value = 0;
+    long differ = 0;
+
+    if (file == NULL) {
+        perror(path);
+        return -1;
+    }
+    if (fscanf(file, "P6 %d %d %d", &width, &height, &max_value) != 3 || fgetc(file) == EOF ||
+        width != SCREEN_WIDTH || height != SCREEN_HEIGHT || max_value != 255 ||
+        fread(reference, 1, sizeof(reference), file) != sizeof(reference)) {
+        fprintf(stderr, "%s: not a %dx%d PPM image\n", path, SCREEN_WIDTH, SCREEN_HEIGHT);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+
+    for (int row = 0; row < SCREEN_HEIGHT; row++) {
+        for (int col = 0; col < SCREEN_WIDTH; col++) {
+            if (memcmp(screen[row][col], reference[row][col], 3) == 0) {
+                continue;
+            }
+            if (differ < MAX_PIXELS_LISTED) {
+                fprintf(stderr, "pixel row %d col %d: rtl %02x%02x%02x, emulator %02x%02x%02x\n", row, col,
+                        screen[row][col][0], screen[row][col][1], screen[row][col][2],
+                        reference[row][col][0], reference[row][col][1], reference[row][col][2]);
+            }
+            differ++;
+        }
+    }
+
+    fprintf(stderr, "%ld of %d pixels differ from %s\n", differ, SCREEN_WIDTH * SCREEN_HEIGHT, path);
+    return differ;
+}
+
+/**
+ * @brief one rising edge of vga_clk; samples the middle of every 4x4 game pixel and ends the frame
+ * once the visible part of the screen has been scanned
+ *
+ * @return true when the testbench is done
+ */
+bool video_edge() {
+    long long position = 0;
+    unsigned long long frame = 0;
+    unsigned int row = 0;
+    unsigned int col = 0;
+
+    vga_clocks++;
+    vga_row = (vga_clocks / HCNT) % VCNT;
+    if (vga_clocks < VIDEO_LATENCY) {
+        return false;
+    }
+
+    // vga_r/g/b now show the pixel the dtg counters were at VIDEO_LATENCY clocks ago
+    position = vga_clocks - VIDEO_LATENCY;
+    frame = position / (HCNT * VCNT);
+    row = (position / HCNT) % VCNT;
+    col = position % HCNT;
+
+    if (row >= GAME_COORDINATE_ROW && col >= GAME_COORDINATE_COL &&
+        (row - GAME_COORDINATE_ROW) % NEW_PIXEL_SIZE == NEW_PIXEL_SIZE / 2 &&
+        (col - GAME_COORDINATE_COL) % NEW_PIXEL_SIZE == NEW_PIXEL_SIZE / 2) {
+        unsigned int game_row = (row - GAME_COORDINATE_ROW) / NEW_PIXEL_SIZE;
+        unsigned int game_col = (col - GAME_COORDINATE_COL) / NEW_PIXEL_SIZE;
+
+        if (game_row < SCREEN_HEIGHT && game_col < SCREEN_WIDTH) {
+            screen[game_row][game_col][0] = top->vga_r * 17;
+            screen[game_row][game_col][1] = top->vga_g * 17;
+            screen[game_row][game_col][2] = top->vga_b * 17;
+        }
+    }
+
+    if (row != VERT_PIXELS || col != 0) {
+        return false;
+    }
+
+    printf("%llu,%lu,%lu,%llu,%llu,%llu\n", frame, stats.writes, stats.reads,
+           stats.bus_cycles, stats.stall_cycles, stats.late_cycles);
+    if (ppm_dir != NULL && frame % capture_every == 0) {
+        save_frame(frame);
+    }
+
+    total.writes += stats.writes;
+    total.reads += stats.reads;
+    total.bus_cycles += stats.bus_cycles;
+    total.stall_cycles += stats.stall_cycles;
+    total.late_cycles += stats.late_cycles;
+    memset(&stats, 0, sizeof(stats));
+
+    // keep going for one whole frame after the last access so the screen it left is captured
+    if (!trace_done || bus_active) {
+        idle_frame_start = frame + 1;
+    }
+    return (max_frames != 0 && frame + 1 >= max_frames) || (frame > idle_frame_start);
+}
+
+int main(int argc, char **argv) {
+    unsigned long long tick = 0;
+    bool done = false;
+    int option = 0;
+
+    while ((option = getopt(argc, argv, "fmn:p:e:c:")) != -1) {
+        switch (option) {
+            case 'f':
+                back_to_back = true;
+                break;
+            case 'm':
+                mid_frame_pages = true;
+                break;
+            case 'n':
+                max_frames = strtoul(optarg, NULL, 10);
+                break;
+            case 'p':
+                ppm_dir = optarg;
+                break;
+            case 'e':
+                capture_every = strtoul(optarg, NULL, 10);
+                if (capture_every == 0) {
+                    capture_every = 1;
+                }
+                break;
+            case 'c':
+                reference_ppm = optarg;
+                break;
+            default:
+                optind = argc + 1;
+                break;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s [-f] [-m] [-n frames] [-p ppm_dir] [-e every_nth_frame] [-c reference_ppm] trace\n", argv[0]);
+        return 1;
+    }
+
+    trace = fopen(argv[optind], "r");
+    if (trace == NULL) {
+        perror(argv[optind]);
+        return 1;
+    }
+    access_pending = next_access();
+    trace_done = !access_pending;
+    trace_base = current_access.cycle;
+
+    Verilated::commandArgs(argc, argv);
+    top = new Vvga_top;
+    top->wb_clk_i = 0;
+    top->vga_clk = 0;
+    top->wb_rst_i = 1;
+    top->wb_cyc_i = 0;
+    top->wb_stb_i = 0;
+    top->wb_we_i = 0;
+    top->eval();
+
+    printf("frame,writes,reads,bus_cycles,stall_cycles,late_cycles\n");
+    while (!done && !Verilated::gotFinish()) {
+        bool wb_toggle = (tick % WB_HALF_PERIOD == 0);
+        bool vga_toggle = (tick % VGA_HALF_PERIOD == 0);
+        bool wb_rise = wb_toggle && !top->wb_clk_i;
+        bool vga_rise = vga_toggle && !top->vga_clk;
+        bool in_reset = top->wb_rst_i;
+        bool ack = top->wb_ack_o;
+
+        tick++;
+        if (!wb_toggle && !vga_toggle) {
+            continue;
+        }
+
+        top->wb_clk_i ^= wb_toggle;
+        top->vga_clk ^= vga_toggle;
+        top->eval();
+
+        if (wb_rise) {
+            if (in_reset) {
+                top->wb_rst_i = (tick / (2 * WB_HALF_PERIOD)) < RESET_CYCLES;
+            }
+            else {
+                bus_edge(ack);
+            }
+        }
+        if (vga_rise && !in_reset) {
+            done = video_edge();
+        }
+        top->eval();
+    }
+
+    fprintf(stderr, "%lu writes, %lu reads: %llu bus cycles (%.2f per access), %llu stall cycles, %llu late cycles\n",
+            total.writes, total.reads, total.bus_cycles,
+            (double) total.bus_cycles / ((total.writes + total.reads) ? (total.writes + total.reads) : 1),
+            total.stall_cycles, total.late_cycles);
+
+    if (mid_frame_pages) {
+        fprintf(stderr, "%lu PAGE_REG writes issued on row %d\n", mid_frame_page_writes, MID_FRAME_ROW);
+    }
+
+    // the RTL has no $finish; the run only stops early on a failed simulation check
+    bool rtl_error = Verilated::gotFinish();
+    long differ = (reference_ppm != NULL) ? compare_frame(reference_ppm) : 0;
+
+    top->final();
+    delete top;
+    fclose(trace);
+    return (rtl_error || differ != 0) ? 1 : 0;
+}
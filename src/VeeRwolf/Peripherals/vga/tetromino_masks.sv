@@ -0,0 +1,60 @@
+/*
+brief: hard coded blocks of every tetris shape and orientation so the RTL can overlay the falling shape on the play area
+from a single register write; same shapes and orientations as shape_orientations in game_core.c
+mask[4*row + col] is set if the block at (row, col) of the 4x4 box of the shape is part of it; the constants are
+written row 3 first and col 0 is the lowest bit of a row, so each row reads mirrored
+*/
+
+module tetromino_masks(
+    input [2:0] shape,       // I, J, L, O, S, T, Z
+    input [1:0] orientation, // 0 = spawn orientation; each one after it is turned 90 degrees clock-wise
+    output reg [15:0] mask
+);
+
+always @(*)
+  case ({shape, orientation})
+    // I-Block
+    5'b000_00: mask = 16'b0000_0000_1111_0000;
+    5'b000_01: mask = 16'b0100_0100_0100_0100;
+    5'b000_10: mask = 16'b0000_1111_0000_0000;
+    5'b000_11: mask = 16'b0010_0010_0010_0010;
+
+    // J-Block
+    5'b001_00: mask = 16'b0000_0100_0111_0000;
+    5'b001_01: mask = 16'b0000_0011_0010_0010;
+    5'b001_10: mask = 16'b0000_0000_0111_0001;
+    5'b001_11: mask = 16'b0000_0010_0010_0110;
+
+    // L-Block
+    5'b010_00: mask = 16'b0000_0001_0111_0000;
+    5'b010_01: mask = 16'b0000_0010_0010_0011;
+    5'b010_10: mask = 16'b0000_0000_0111_0100;
+    5'b010_11: mask = 16'b0000_0110_0010_0010;
+
+    // O-Block
+    5'b011_00: mask = 16'b0000_0000_0011_0011;
+    5'b011_01: mask = 16'b0000_0000_0011_0011;
+    5'b011_10: mask = 16'b0000_0000_0011_0011;
+    5'b011_11: mask = 16'b0000_0000_0011_0011;
+
+    // S-Block
+    5'b100_00: mask = 16'b0000_0011_0110_0000;
+    5'b100_01: mask = 16'b0000_0010_0011_0001;
+    5'b100_10: mask = 16'b0000_0000_0011_0110;
+    5'b100_11: mask = 16'b0000_0100_0110_0010;
+
+    // T-Block
+    5'b101_00: mask = 16'b0000_0010_0111_0000;
+    5'b101_01: mask = 16'b0000_0010_0011_0010;
+    5'b101_10: mask = 16'b0000_0000_0111_0010;
+    5'b101_11: mask = 16'b0000_0010_0110_0010;
+
+    // Z-Block
+    5'b110_00: mask = 16'b0000_0110_0011_0000;
+    5'b110_01: mask = 16'b0000_0001_0011_0010;
+    5'b110_10: mask = 16'b0000_0000_0110_0011;
+    5'b110_11: mask = 16'b0000_0010_0110_0100;
+
+    default: mask = 16'b0;
+  endcase
+endmodule
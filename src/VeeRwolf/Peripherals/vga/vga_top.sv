@@ -32,7 +32,8 @@ module vga_top(
     output reg [3:0] vga_g,
     output reg [3:0] vga_b,
     output wire h_sync,
-    output wire v_sync
+    output wire v_sync,
+    output wire wb_inta_o       // vertical blank interrupt request
 );
 
 // returned values from DTG module
@@ -43,7 +44,8 @@ reg [31:0] screen_vectorization;
 reg [2:0] row_offset, col_offset, digit_index;
 
 // returned values from RAM module
-reg [11:0] current_pixel_color;
+reg [`COLOR_INDEX_BITS-1:0] current_color_index;
+wire [11:0] current_pixel_color;
 
 // returned values from game sections module
 reg on_game_screen; 
@@ -52,6 +54,10 @@ reg on_level_screen;
 reg on_lines_screen;
 reg on_next_block_screen;
 
+// returned values from play area tile map
+reg on_play_area;
+reg [11:0] tile_pixel_color;
+
 // returned values from chars module
 reg [7:0] score_number_layer;
 reg [7:0] level_number_layer;
@@ -63,11 +69,33 @@ reg wb_ack_ff;
 reg [31:0] screen_position_register;
 reg [31:0] rgb_value_register;
 reg [9:0]  cpu_row_position, cpu_col_position;
-reg [11:0] cpu_rgb_value;
+reg [`COLOR_INDEX_BITS-1:0] cpu_color_index;
 reg [31:0] next_tetris_block;
 reg [31:0] score_register;
 reg [31:0] level_register;
 reg [31:0] lines_register;
+reg [31:0] tile_register;  // bit 31 = tile map mode; bits 28:24 = block row; bits 20:16 = block col; bits 3:0 = tile id
+reg tile_we;
+reg [31:0] stream_register; // bit 31 = streaming on; bits 27:20 = row width; bits 19:10 = start row; bits 9:0 = start col
+reg stream_first;           // next RGB write of the stream goes to the start position
+reg [31:0] shift_register;  // bits 28:24 = bottom row of the cleared band; bits 2:0 = rows in the band
+reg shift_busy;             // row shift engine is moving the play area tile map down or waiting for the blank to
+reg [31:0] palette_register; // bits 27:24 = palette entry; bits 11:0 = color of the entry
+reg [11:0] palette [`NUM_OF_PAGES*`PALETTE_SIZE-1:0]; // one palette per page
+reg [31:0] flash_register;   // bits 17:0 = play area rows drawn gray
+reg [31:0] page_register;    // bit 4 = page to show from the next vertical blank; bit 0 = page the CPU draws into
+reg display_page;            // page on screen; vga_clk domain, only changes in the vertical blank
+reg [1:0] display_request_sync, display_page_sync; // page_register[4] into the vga_clk domain and display_page back
+wire flip_pending = display_page_sync[1] != page_register[4];
+reg [31:0] piece_register;   // falling shape and its ghost overlaid on the play area; see play_area_tiles
+reg [31:0] frame_register;   // bit 0 = vertical blank interrupt on
+reg [23:0] frame_count;      // vertical blanks since reset
+reg vblank_pending;          // set at the start of every vertical blank; cleared by writing frame_register bit 31
+reg vblank_toggle;           // vga_clk domain; flips at the start of every vertical blank
+reg in_vblank;               // vga_clk domain
+reg [2:0] vblank_toggle_sync;
+reg [1:0] in_vblank_sync;
+wire shift_start = wb_ack_ff && wb_we_i && wb_adr_i[5:2] == 11;
 
 reg [11:0] tetris_block_color;
 
@@ -79,8 +107,26 @@ initial begin
     score_register <= '0;
     level_register <= '0;
     lines_register <= '0;
-    timer <= '0;
-    counter <= '0;
+    tile_register <= '0;
+    stream_register <= '0;
+    stream_first <= '0;
+    shift_register <= '0;
+    palette_register <= '0;
+    flash_register <= '0;
+    page_register <= '0;
+    display_page <= '0;
+    display_request_sync <= '0;
+    display_page_sync <= '0;
+    piece_register <= '0;
+    frame_register <= '0;
+    frame_count <= '0;
+    vblank_pending <= '0;
+    vblank_toggle <= '0;
+    in_vblank <= '0;
+    vblank_toggle_sync <= '0;
+    in_vblank_sync <= '0;
+    for (int i = 0; i < `NUM_OF_PAGES*`PALETTE_SIZE; i++)
+        palette[i] <= '0;
 end
 
 // get register values from RISC-V core
@@ -88,20 +134,48 @@ always @(posedge wb_clk_i, posedge wb_rst_i) begin
     if (wb_rst_i) begin
         screen_position_register <= '0;
         rgb_value_register <= '0;
+        cpu_row_position <= '0;
+        cpu_col_position <= '0;
+        stream_register <= '0;
+        stream_first <= '0;
         wb_ack_ff <= '0;
+        tile_we <= '0;
+        piece_register <= '0;
+        frame_register <= '0;
+        frame_count <= '0;
+        vblank_pending <= '0;
+        vblank_toggle_sync <= '0;
+        in_vblank_sync <= '0;
     end
     else begin
         case (wb_adr_i[5:2])
             0: 
             begin 
                 screen_position_register = wb_ack_ff && wb_we_i ? wb_dat_i : screen_position_register;
-                cpu_row_position = screen_position_register[19:10];
-                cpu_col_position = screen_position_register[9:0];
+                if (wb_ack_ff && wb_we_i) begin
+                    cpu_row_position = screen_position_register[19:10];
+                    cpu_col_position = screen_position_register[9:0];
+                    stream_register[31] = 1'b0; // positioning a single pixel ends a stream
+                end
             end
             1: 
             begin
                 rgb_value_register = wb_ack_ff && wb_we_i ? wb_dat_i : rgb_value_register;
-                cpu_rgb_value = rgb_value_register[11:0];
+                cpu_color_index = rgb_value_register[`COLOR_INDEX_BITS-1:0];
+                // streaming: move to the next pixel before it is written so the last pixel is never written twice
+                if (wb_ack_ff && wb_we_i && stream_register[31]) begin
+                    if (stream_first) begin
+                        cpu_row_position = stream_register[19:10];
+                        cpu_col_position = stream_register[9:0];
+                        stream_first = 1'b0;
+                    end
+                    else if (cpu_col_position + 1 == stream_register[9:0] + stream_register[27:20]) begin
+                        cpu_row_position = cpu_row_position + 1;
+                        cpu_col_position = stream_register[9:0];
+                    end
+                    else
+                        cpu_col_position = cpu_col_position + 1;
+                end
             end
             2:
             begin
@@ -119,8 +193,58 @@ always @(posedge wb_clk_i, posedge wb_rst_i) begin
             begin
                 lines_register = wb_ack_ff && wb_we_i ? wb_dat_i : lines_register;
             end
+            6:
+            begin
+                piece_register = wb_ack_ff && wb_we_i ? wb_dat_i : piece_register;
+            end
+            9:
+            begin
+                tile_register = wb_ack_ff && wb_we_i ? wb_dat_i : tile_register;
+            end
+            10:
+            begin
+                stream_register = wb_ack_ff && wb_we_i ? wb_dat_i : stream_register;
+                stream_first = wb_ack_ff && wb_we_i ? 1'b1 : stream_first;
+            end
+            11:
+            begin
+                shift_register = wb_ack_ff && wb_we_i ? wb_dat_i : shift_register;
+            end
+            12:
+            begin
+                palette_register = wb_ack_ff && wb_we_i ? wb_dat_i : palette_register;
+                if (wb_ack_ff && wb_we_i)
+                    palette[{page_register[0], palette_register[27:24]}] = palette_register[11:0];
+            end
+            13:
+            begin
+                flash_register = wb_ack_ff && wb_we_i ? wb_dat_i : flash_register;
+            end
+            14:
+            begin
+                page_register = wb_ack_ff && wb_we_i ? wb_dat_i : page_register;
+            end
+            15:
+            begin
+                frame_register = wb_ack_ff && wb_we_i ? wb_dat_i : frame_register;
+            end
         endcase
-        wb_ack_ff <= !wb_ack_ff && wb_stb_i && wb_cyc_i;
+        tile_we <= wb_ack_ff && wb_we_i && wb_adr_i[5:2] == 9;
+        display_page_sync <= {display_page_sync[0], display_page};
+
+        // count vertical blanks; a new one wins over a clear in the same cycle so it is never lost
+        vblank_toggle_sync <= {vblank_toggle_sync[1:0], vblank_toggle};
+        in_vblank_sync <= {in_vblank_sync[0], in_vblank};
+        if (vblank_toggle_sync[2] != vblank_toggle_sync[1]) begin
+            frame_count <= frame_count + 1;
+            vblank_pending <= 1'b1;
+        end
+        else if (wb_ack_ff && wb_we_i && wb_adr_i[5:2] == 15 && wb_dat_i[31])
+            vblank_pending <= 1'b0;
+
+        // writes are held off until the tile map has been shifted; a shift asked for mid-frame waits for the
+        // vertical blank, which the game loop already runs in, so it is not held off for long
+        wb_ack_ff <= !wb_ack_ff && wb_stb_i && wb_cyc_i && !(shift_busy && wb_we_i);
     end
 end
 
@@ -131,9 +255,43 @@ assign wb_dat_o = (
     ((wb_adr_i[5:2] == 1) ? rgb_value_register :
     ((wb_adr_i[5:2] == 2) ? next_tetris_block :
     ((wb_adr_i[5:2] == 3) ? score_register :
-    ((wb_adr_i[5:2] == 4) ? level_register : lines_register))))
+    ((wb_adr_i[5:2] == 4) ? level_register : 
+    ((wb_adr_i[5:2] == 6) ? piece_register : 
+    ((wb_adr_i[5:2] == 9) ? tile_register : 
+    ((wb_adr_i[5:2] == 10) ? stream_register : 
+    ((wb_adr_i[5:2] == 11) ? {shift_busy, shift_register[30:0]} :
+    ((wb_adr_i[5:2] == 12) ? palette_register :
+    ((wb_adr_i[5:2] == 13) ? flash_register :
+    ((wb_adr_i[5:2] == 14) ? {flip_pending, 22'b0, display_page_sync[1], page_register[7:0]} :
+    ((wb_adr_i[5:2] == 15) ? {vblank_pending, in_vblank_sync[1], 5'b0, frame_register[0], frame_count} :
+    lines_register))))))))))))
 );
 
+// level interrupt; stays up until the vertical blank is cleared
+assign wb_inta_o = vblank_pending && frame_register[0];
+
+// game_ram holds palette indexes; the color is looked up on the way out in the palette of the page on screen
+assign current_pixel_color = palette[{display_page, current_color_index}];
+
+// flip pages only in the vertical blank so a frame is always scanned out of a single page; the start of the
+// vertical blank is passed to the wishbone side as a toggle
+always @(posedge vga_clk or posedge wb_rst_i) begin
+    if (wb_rst_i) begin
+        display_request_sync <= '0;
+        display_page <= '0;
+        vblank_toggle <= '0;
+        in_vblank <= '0;
+    end
+    else begin
+        display_request_sync <= {display_request_sync[0], page_register[4]};
+        in_vblank <= vga_row_position >= `VGA_VERT_PIXELS;
+        if (vga_row_position == `VGA_VERT_PIXELS && vga_col_position == 0) begin
+            display_page <= display_request_sync[1];
+            vblank_toggle <= ~vblank_toggle;
+        end
+    end
+end
+
 // dtg is used for horizontal & Vertical Display Timing & Sync generator for VESA timing
 dtg dtg_inst(
     .clock        (vga_clk),
@@ -151,14 +309,38 @@ game_ram get_game_frame(
     .vga_clk             (vga_clk),
     .wb_clk_i            (wb_clk_i),
     .wb_rst_i            (wb_rst_i),
+    .cpu_page            (page_register[0]),
+    .vga_page            (display_page),
     .cpu_row_position    (cpu_row_position),
     .cpu_col_position    (cpu_col_position),
-    .cpu_rgb_value       (cpu_rgb_value),
+    .cpu_color_index     (cpu_color_index),
     .vga_row_position    (vga_row_position),
     .vga_col_position    (vga_col_position),
     .vga_on_screen       (on_screen),
     .vga_on_game_screen  (on_game_screen),
-    .current_pixel_color (current_pixel_color)
+    .current_color_index (current_color_index)
+);
+
+// get play area from the tile map when tile map mode is on (tile_register[31])
+play_area_tiles get_play_area(
+    .vga_clk          (vga_clk),
+    .wb_clk_i         (wb_clk_i),
+    .wb_rst_i         (wb_rst_i),
+    .tile_we          (tile_we),
+    .tile_row         (tile_register[28:24]),
+    .tile_col         (tile_register[19:16]),
+    .tile_id          (tile_register[3:0]),
+    .shift_start      (shift_start),
+    .shift_row        (wb_dat_i[28:24]),    // taken from the bus so the engine is busy before the next write is acked
+    .shift_count      (wb_dat_i[2:0]),
+    .shift_enable     (in_vblank_sync[1]),
+    .shift_busy       (shift_busy),
+    .flash_rows       (flash_register[`PLAY_AREA_BLOCKS_TALL-1:0]),
+    .piece            (piece_register),
+    .vga_row_position (vga_row_position),
+    .vga_col_position (vga_col_position),
+    .on_play_area     (on_play_area),
+    .tile_pixel_color (tile_pixel_color)
 );
 
 // get TRUE/FALSE values to pass to VGA RTL
@@ -274,6 +456,13 @@ always @(posedge vga_clk or posedge wb_rst_i) begin
                     vga_b <= `WHITE;
                 end
             end
+            else if (tile_register[31] && on_play_area)
+            begin // draw play area from the tile map
+                row_offset <= 0; col_offset <= 0; digit_index <= 0;
+                vga_r <= tile_pixel_color[11:8];
+                vga_g <= tile_pixel_color[7:4];
+                vga_b <= tile_pixel_color[3:0];
+            end
             else 
             begin // draw game frame from RAM
                 row_offset <= 0; col_offset <= 0; digit_index <= 0;
@@ -282,6 +471,11 @@ always @(posedge vga_clk or posedge wb_rst_i) begin
                 vga_b <= current_pixel_color[3:0];
             end
         end
+        else if (tile_register[31] && on_play_area) begin // RTL sections OFF but play area comes from the tile map
+            vga_r <= tile_pixel_color[11:8];
+            vga_g <= tile_pixel_color[7:4];
+            vga_b <= tile_pixel_color[3:0];
+        end
         else begin // user wants to turn OFF RTL driven sections
             vga_r <= current_pixel_color[11:8];
             vga_g <= current_pixel_color[7:4];
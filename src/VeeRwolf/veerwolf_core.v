@@ -172,7 +172,8 @@ module veerwolf_core
    wire spi0_irq;
    wire sw_irq4;
    wire sw_irq3;
-   // wire vga_irq;
+   wire vga_irq;
+   wire ps2_irq;
    wire rgb_irq;
    wire nmi_int;
 
@@ -444,7 +445,8 @@ module veerwolf_core
       .vga_g        (vga_green),
       .vga_b        (vga_blue),
       .h_sync       (h_sync),
-      .v_sync       (v_sync)
+      .v_sync       (v_sync),
+      .wb_inta_o    (vga_irq)
    );
 
    //keyboard module instantiation
@@ -461,6 +463,7 @@ module veerwolf_core
         .wb_dat_o     (wb_s2m_ps2_dat),
         .wb_ack_o     (wb_s2m_ps2_ack), 
         .wb_err_o     (wb_s2m_ps2_err),
+        .wb_inta_o    (ps2_irq),
 
 		// keyboard interface signals
 		.PS2_CLK (ps2_clock),
@@ -827,7 +830,7 @@ module veerwolf_core
       .dma_bus_clk_en (1'b1),
 
       .timer_int (timer_irq),
-      .extintsrc_req ({4'd0, sw_irq4, sw_irq3, spi0_irq, uart_irq}),
+      .extintsrc_req ({2'd0, vga_irq, ps2_irq, sw_irq4, sw_irq3, spi0_irq, uart_irq}),
 
       .dec_tlu_perfcnt0 (),
       .dec_tlu_perfcnt1 (),